@@ -2,6 +2,8 @@
 //
 // Copyright (c) 2020-2022 Antonio Niño Díaz
 
+#include "../../../../include/bn_config_hbes.h"
+
     .section .iwram, "ax", %progbits
     .code 32
 
@@ -39,6 +41,14 @@ IRQ_GlobalInterruptHandler:
     tst     r1, r2
     bne     interrupt_found
 
+#if BN_CFG_HBES_SPARSE_MAX_LINES
+    add     r3, r3, #4
+    mov     r2, #(1 << 2) // VCOUNT
+    tst     r1, r2
+    bne     interrupt_found
+
+    sub     r3, r3, #8
+#else
     # add     r3, r3, #4
     # mov     r2, #(1 << 2) // VCOUNT
     # tst     r1, r2
@@ -46,6 +56,7 @@ IRQ_GlobalInterruptHandler:
 
     # sub     r3, r3, #8
     sub     r3, r3, #4
+#endif
     mov     r2, #(1 << 0) // VBLANK
     tst     r1, r2
     bne     interrupt_found
@@ -71,6 +71,10 @@ namespace bn::hw::bg_blocks
             hw::decompress::huff(source_ptr, destination_ptr);
             break;
 
+        case compression_type::LZ4:
+            hw::decompress::lz4(source_ptr, destination_ptr);
+            break;
+
         default:
             BN_ERROR("Unknown compression type: ", int(compression));
             break;
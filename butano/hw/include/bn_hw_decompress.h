@@ -7,33 +7,51 @@
 #define BN_HW_DECOMPRESS_H
 
 #include "bn_common.h"
-#include "../3rd_party/cult-of-gba-bios/include/cult-of-gba-bios.h"
 
 namespace bn::hw::decompress
 {
+    BN_CODE_IWRAM void _lz77_wram(const uint8_t* source_ptr, uint8_t* destination_ptr);
+
+    BN_CODE_IWRAM void _lz77_vram(const uint8_t* source_ptr, void* destination_ptr);
+
+    BN_CODE_IWRAM void _rl_wram(const uint8_t* source_ptr, uint8_t* destination_ptr);
+
+    BN_CODE_IWRAM void _rl_vram(const uint8_t* source_ptr, void* destination_ptr);
+
+    BN_CODE_IWRAM void _lz4(const uint16_t* source_ptr, uint16_t* destination_ptr);
+
+    BN_CODE_IWRAM void _huff(const uint8_t* source_ptr, uint32_t* destination_ptr);
+
     inline void lz77_wram(const void* src, void* dst)
     {
-        swi_LZ77UnCompWrite8bit(src, dst);
+        _lz77_wram(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst));
     }
 
     inline void lz77_vram(const void* src, void* dst)
     {
-        swi_LZ77UnCompWrite16bit(src, dst);
+        _lz77_vram(static_cast<const uint8_t*>(src), dst);
     }
 
     inline void rl_wram(const void* src, void* dst)
     {
-        swi_RLUnCompReadNormalWrite8bit(src, dst);
+        _rl_wram(static_cast<const uint8_t*>(src), static_cast<uint8_t*>(dst));
     }
 
     inline void rl_vram(const void* src, void* dst)
     {
-        swi_RLUnCompReadNormalWrite16bit(src, dst);
+        _rl_vram(static_cast<const uint8_t*>(src), dst);
+    }
+
+    inline void lz4(const void* src, void* dst)
+    {
+        // Half word based, so it works with both WRAM and VRAM:
+        _lz4(static_cast<const uint16_t*>(src), static_cast<uint16_t*>(dst));
     }
 
     inline void huff(const void* src, void* dst)
     {
-        swi_HuffUnCompReadNormal(src, dst);
+        // Word based, so it works with both WRAM and VRAM:
+        _huff(static_cast<const uint8_t*>(src), static_cast<uint32_t*>(dst));
     }
 }
 
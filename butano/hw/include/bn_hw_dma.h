@@ -16,6 +16,11 @@ namespace bn::hw::dma
     return 3;
 }
 
+[[nodiscard]] constexpr int medium_priority_channel()
+{
+    return 2;
+}
+
 [[nodiscard]] constexpr int high_priority_channel()
 {
     return 0;
@@ -45,6 +50,14 @@ inline void start_hdma(int channel, const uint16_t* source, int half_words, uint
     REG_DMA[channel].cnt = half_words | DMA_HDMA;
 }
 
+inline void start_hdma_words(int channel, const void* source, int words, void* destination)
+{
+    REG_DMA[channel].cnt = 0;
+    REG_DMA[channel].src = source;
+    REG_DMA[channel].dst = destination;
+    REG_DMA[channel].cnt = words | DMA_HDMA | DMA_32;
+}
+
 inline void stop_hdma(int channel)
 {
     REG_DMA[channel].cnt = 0;
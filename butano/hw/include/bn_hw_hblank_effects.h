@@ -9,6 +9,8 @@
 #include "bn_algorithm.h"
 #include "bn_config_hbes.h"
 #include "bn_hw_irq.h"
+#include "bn_hw_tonc.h"
+#include "bn_hw_display_constants.h"
 
 namespace bn::hw::hblank_effects
 {
@@ -33,6 +35,11 @@ namespace bn::hw::hblank_effects
         return 4;
     }
 
+    [[nodiscard]] constexpr int last_vcount()
+    {
+        return 227;
+    }
+
     class entries
     {
 
@@ -41,25 +48,55 @@ namespace bn::hw::hblank_effects
         uint16_entry uint16_entries[BN_CFG_HBES_MAX_ITEMS];
         int uint32_entries_count = 0;
         uint32_entry uint32_entries[max_uint32_entries()];
+
+        #if BN_CFG_HBES_SPARSE_MAX_LINES
+            bool sparse = false;
+            uint8_t next_change_lines[display::height()];
+        #endif
     };
 
     extern entries* data;
 
     BN_CODE_IWRAM void _intr();
 
+    #if BN_CFG_HBES_SPARSE_MAX_LINES
+        BN_CODE_IWRAM void _sparse_intr();
+
+        BN_CODE_IWRAM void _vcount_intr();
+    #endif
+
     inline void commit_entries(entries& entries_ref)
     {
         data = &entries_ref;
     }
 
-    inline void enable()
+    inline void enable([[maybe_unused]] bool sparse)
     {
+        #if BN_CFG_HBES_SPARSE_MAX_LINES
+            if(sparse)
+            {
+                // The H-Blank interrupt disables itself in DISPSTAT until the line before the next change,
+                // when the V-Count interrupt enables it again:
+                irq::set_isr(irq::id::HBLANK, _sparse_intr);
+                REG_DISPSTAT = (REG_DISPSTAT & ~DSTAT_VCT_MASK) | DSTAT_VCT(last_vcount());
+                irq::enable(irq::id::VCOUNT);
+                irq::enable(irq::id::HBLANK);
+                return;
+            }
+
+            irq::set_isr(irq::id::HBLANK, _intr);
+        #endif
+
         irq::enable(irq::id::HBLANK);
     }
 
     inline void disable()
     {
         irq::disable(irq::id::HBLANK);
+
+        #if BN_CFG_HBES_SPARSE_MAX_LINES
+            irq::disable(irq::id::VCOUNT);
+        #endif
     }
 }
 
@@ -72,6 +72,10 @@ namespace bn::hw::sprite_tiles
             hw::decompress::huff(source_tiles_ptr, tile_vram(index));
             break;
 
+        case compression_type::LZ4:
+            hw::decompress::lz4(source_tiles_ptr, tile_vram(index));
+            break;
+
         default:
             BN_ERROR("Unknown compression type: ", int(compression));
             break;
@@ -0,0 +1,529 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "../include/bn_hw_decompress.h"
+
+#include "bn_algorithm.h"
+
+namespace bn::hw::decompress
+{
+
+namespace
+{
+    // VRAM doesn't support 8-bit writes, so bytes are written in pairs:
+    class vram_writer
+    {
+
+    public:
+        explicit vram_writer(void* destination_ptr) :
+            _bytes(static_cast<uint8_t*>(destination_ptr))
+        {
+        }
+
+        [[nodiscard]] unsigned position() const
+        {
+            return _position;
+        }
+
+        [[nodiscard]] unsigned window_byte(unsigned displacement) const
+        {
+            unsigned position = _position;
+
+            if(displacement == 1 && (position & 1))
+            {
+                return _pending;
+            }
+
+            return _bytes[position - displacement];
+        }
+
+        void put(unsigned byte)
+        {
+            unsigned position = _position;
+
+            if(position & 1)
+            {
+                *reinterpret_cast<uint16_t*>(_bytes + position - 1) = uint16_t(_pending | (byte << 8));
+            }
+            else
+            {
+                _pending = byte;
+            }
+
+            _position = position + 1;
+        }
+
+        void put_half_word(unsigned half_word)
+        {
+            unsigned position = _position;
+            *reinterpret_cast<uint16_t*>(_bytes + position) = uint16_t(half_word);
+            _position = position + 2;
+        }
+
+        void fill(unsigned byte, unsigned count)
+        {
+            if(_position & 1)
+            {
+                put(byte);
+                --count;
+            }
+
+            unsigned half_word = byte | (byte << 8);
+            auto half_words_ptr = reinterpret_cast<uint16_t*>(_bytes + _position);
+            unsigned half_words = count >> 1;
+
+            for(unsigned index = 0; index < half_words; ++index)
+            {
+                half_words_ptr[index] = uint16_t(half_word);
+            }
+
+            _position += half_words << 1;
+
+            if(count & 1)
+            {
+                put(byte);
+            }
+        }
+
+        void copy(unsigned displacement, unsigned count)
+        {
+            if(displacement == 1)
+            {
+                fill(window_byte(1), count);
+            }
+            else if(displacement & 1)
+            {
+                for(unsigned index = 0; index < count; ++index)
+                {
+                    put(window_byte(displacement));
+                }
+            }
+            else
+            {
+                // Even displacement: source and destination share alignment, so half words can be copied.
+                if(_position & 1)
+                {
+                    put(window_byte(displacement));
+                    --count;
+                }
+
+                auto half_words_ptr = reinterpret_cast<uint16_t*>(_bytes + _position);
+                const uint16_t* source_half_words_ptr = half_words_ptr - (displacement >> 1);
+                unsigned half_words = count >> 1;
+
+                for(unsigned index = 0; index < half_words; ++index)
+                {
+                    half_words_ptr[index] = source_half_words_ptr[index];
+                }
+
+                _position += half_words << 1;
+
+                if(count & 1)
+                {
+                    put(window_byte(displacement));
+                }
+            }
+        }
+
+    private:
+        uint8_t* _bytes;
+        unsigned _position = 0;
+        unsigned _pending = 0;
+    };
+
+    [[nodiscard]] unsigned decompressed_bytes(const uint8_t* source_ptr)
+    {
+        return *reinterpret_cast<const unsigned*>(source_ptr) >> 8;
+    }
+
+    // Huffman trees nodes store the offset to their children in half words,
+    // and the two highest bits indicate which children are data (leaves):
+    [[nodiscard]] const uint8_t* huffman_child(const uint8_t* node_ptr, unsigned node, unsigned bit)
+    {
+        return reinterpret_cast<const uint8_t*>((uintptr_t(node_ptr) & ~uintptr_t(1)) + ((node & 0x3F) * 2) + 2 + bit);
+    }
+
+    // Fills the lookup table entries of the codes whose prefix is the given one.
+    // Resolved entries store the symbol and the code length in bits,
+    // and unresolved ones the offset to the node reached after 8 bits:
+    void fill_huffman_table(const uint8_t* root_ptr, const uint8_t* node_ptr, unsigned prefix, unsigned depth,
+                            uint16_t* table)
+    {
+        unsigned node = *node_ptr;
+        unsigned child_depth = depth + 1;
+
+        for(unsigned bit = 0; bit < 2; ++bit)
+        {
+            const uint8_t* child_ptr = huffman_child(node_ptr, node, bit);
+            unsigned child_prefix = (prefix << 1) | bit;
+
+            if(node & (0x80 >> bit))
+            {
+                unsigned shift = 8 - child_depth;
+                unsigned entry = *child_ptr | (child_depth << 8);
+                uint16_t* entries = table + (child_prefix << shift);
+
+                for(unsigned index = 0, limit = 1u << shift; index < limit; ++index)
+                {
+                    entries[index] = uint16_t(entry);
+                }
+            }
+            else if(child_depth == 8)
+            {
+                table[child_prefix] = uint16_t(0x8000 | unsigned(child_ptr - root_ptr));
+            }
+            else
+            {
+                fill_huffman_table(root_ptr, child_ptr, child_prefix, child_depth, table);
+            }
+        }
+    }
+
+    // Huffman bit streams are read from 32 bits words, most significant bit first:
+    class huffman_reader
+    {
+
+    public:
+        explicit huffman_reader(const uint32_t* source_ptr) :
+            _source_ptr(source_ptr + 2),
+            _current(source_ptr[0]),
+            _next(source_ptr[1])
+        {
+        }
+
+        [[nodiscard]] unsigned peek_byte() const
+        {
+            unsigned result = _current >> 24;
+            unsigned available = _available;
+
+            if(available < 8)
+            {
+                result |= _next >> (available + 24);
+            }
+
+            return result;
+        }
+
+        [[nodiscard]] unsigned bit()
+        {
+            unsigned result = _current >> 31;
+            consume(1);
+            return result;
+        }
+
+        void consume(unsigned bits)
+        {
+            unsigned available = _available;
+
+            if(bits < available)
+            {
+                _current <<= bits;
+                _available = available - bits;
+            }
+            else
+            {
+                bits -= available;
+                _current = _next << bits;
+                _available = 32 - bits;
+                _next = *_source_ptr++;
+            }
+        }
+
+    private:
+        const uint32_t* _source_ptr;
+        uint32_t _current;
+        uint32_t _next;
+        unsigned _available = 32;
+    };
+
+    // Forward copy, so matches overlapping the destination by at least one word are also supported:
+    void copy_half_words(const uint16_t* source_ptr, unsigned half_words, uint16_t* destination_ptr)
+    {
+        if(half_words >= 4 && ! ((uintptr_t(source_ptr) ^ uintptr_t(destination_ptr)) & 2))
+        {
+            if(uintptr_t(destination_ptr) & 2)
+            {
+                *destination_ptr++ = *source_ptr++;
+                --half_words;
+            }
+
+            auto words_ptr = reinterpret_cast<uint32_t*>(destination_ptr);
+            auto source_words_ptr = reinterpret_cast<const uint32_t*>(source_ptr);
+            unsigned words = half_words >> 1;
+
+            for(unsigned index = 0; index < words; ++index)
+            {
+                words_ptr[index] = source_words_ptr[index];
+            }
+
+            destination_ptr += words << 1;
+            source_ptr += words << 1;
+            half_words &= 1;
+        }
+
+        for(unsigned index = 0; index < half_words; ++index)
+        {
+            destination_ptr[index] = source_ptr[index];
+        }
+    }
+}
+
+void _lz77_wram(const uint8_t* source_ptr, uint8_t* destination_ptr)
+{
+    uint8_t* destination_end = destination_ptr + decompressed_bytes(source_ptr);
+    source_ptr += 4;
+
+    while(destination_ptr < destination_end)
+    {
+        unsigned flags = *source_ptr++;
+
+        if(! flags && destination_end - destination_ptr >= 8)
+        {
+            // Eight literals in a row:
+            for(int index = 0; index < 8; ++index)
+            {
+                destination_ptr[index] = source_ptr[index];
+            }
+
+            source_ptr += 8;
+            destination_ptr += 8;
+            continue;
+        }
+
+        for(unsigned mask = 0x80; mask && destination_ptr < destination_end; mask >>= 1)
+        {
+            if(flags & mask)
+            {
+                unsigned high = source_ptr[0];
+                unsigned low = source_ptr[1];
+                source_ptr += 2;
+
+                unsigned displacement = (((high & 0xF) << 8) | low) + 1;
+                auto count = int((high >> 4) + 3);
+                count = min(count, destination_end - destination_ptr);
+
+                const uint8_t* window_ptr = destination_ptr - displacement;
+
+                for(int index = 0; index < count; ++index)
+                {
+                    destination_ptr[index] = window_ptr[index];
+                }
+
+                destination_ptr += count;
+            }
+            else
+            {
+                *destination_ptr++ = *source_ptr++;
+            }
+        }
+    }
+}
+
+void _lz77_vram(const uint8_t* source_ptr, void* destination_ptr)
+{
+    vram_writer writer(destination_ptr);
+    unsigned bytes = decompressed_bytes(source_ptr);
+    source_ptr += 4;
+
+    while(writer.position() < bytes)
+    {
+        unsigned flags = *source_ptr++;
+
+        if(! flags && ! (writer.position() & 1) && bytes - writer.position() >= 8)
+        {
+            // Eight literals in a row:
+            for(int index = 0; index < 8; index += 2)
+            {
+                writer.put_half_word(source_ptr[index] | (unsigned(source_ptr[index + 1]) << 8));
+            }
+
+            source_ptr += 8;
+            continue;
+        }
+
+        for(unsigned mask = 0x80; mask && writer.position() < bytes; mask >>= 1)
+        {
+            if(flags & mask)
+            {
+                unsigned high = source_ptr[0];
+                unsigned low = source_ptr[1];
+                source_ptr += 2;
+
+                unsigned displacement = (((high & 0xF) << 8) | low) + 1;
+                unsigned count = min((high >> 4) + 3, bytes - writer.position());
+                writer.copy(displacement, count);
+            }
+            else
+            {
+                writer.put(*source_ptr++);
+            }
+        }
+    }
+}
+
+void _rl_wram(const uint8_t* source_ptr, uint8_t* destination_ptr)
+{
+    uint8_t* destination_end = destination_ptr + decompressed_bytes(source_ptr);
+    source_ptr += 4;
+
+    while(destination_ptr < destination_end)
+    {
+        unsigned flag = *source_ptr++;
+
+        if(flag & 0x80)
+        {
+            auto count = int((flag & 0x7F) + 3);
+            count = min(count, destination_end - destination_ptr);
+
+            uint8_t value = *source_ptr++;
+
+            for(int index = 0; index < count; ++index)
+            {
+                destination_ptr[index] = value;
+            }
+
+            destination_ptr += count;
+        }
+        else
+        {
+            auto count = int((flag & 0x7F) + 1);
+            count = min(count, destination_end - destination_ptr);
+
+            for(int index = 0; index < count; ++index)
+            {
+                destination_ptr[index] = source_ptr[index];
+            }
+
+            source_ptr += (flag & 0x7F) + 1;
+            destination_ptr += count;
+        }
+    }
+}
+
+void _rl_vram(const uint8_t* source_ptr, void* destination_ptr)
+{
+    vram_writer writer(destination_ptr);
+    unsigned bytes = decompressed_bytes(source_ptr);
+    source_ptr += 4;
+
+    while(writer.position() < bytes)
+    {
+        unsigned flag = *source_ptr++;
+
+        if(flag & 0x80)
+        {
+            unsigned count = min((flag & 0x7F) + 3, bytes - writer.position());
+            writer.fill(*source_ptr++, count);
+        }
+        else
+        {
+            unsigned literals = (flag & 0x7F) + 1;
+            unsigned count = min(literals, bytes - writer.position());
+
+            for(unsigned index = 0; index < count; ++index)
+            {
+                writer.put(source_ptr[index]);
+            }
+
+            source_ptr += literals;
+        }
+    }
+}
+
+void _lz4(const uint16_t* source_ptr, uint16_t* destination_ptr)
+{
+    unsigned bytes = decompressed_bytes(reinterpret_cast<const uint8_t*>(source_ptr));
+    uint16_t* destination_end = destination_ptr + (bytes >> 1);
+    source_ptr += 2;
+
+    while(destination_ptr < destination_end)
+    {
+        unsigned token = *source_ptr++;
+        unsigned literals = token & 0xFF;
+        unsigned matches = token >> 8;
+
+        copy_half_words(source_ptr, literals, destination_ptr);
+        source_ptr += literals;
+        destination_ptr += literals;
+
+        if(matches)
+        {
+            unsigned offset = *source_ptr++;
+
+            if(offset == 1)
+            {
+                unsigned value = destination_ptr[-1];
+
+                for(unsigned index = 0; index < matches; ++index)
+                {
+                    destination_ptr[index] = uint16_t(value);
+                }
+            }
+            else
+            {
+                copy_half_words(destination_ptr - offset, matches, destination_ptr);
+            }
+
+            destination_ptr += matches;
+        }
+    }
+}
+
+void _huff(const uint8_t* source_ptr, uint32_t* destination_ptr)
+{
+    unsigned header = *reinterpret_cast<const unsigned*>(source_ptr);
+    unsigned data_size = header & 0xF;
+    uint32_t* destination_end = destination_ptr + (((header >> 8) + 3) >> 2);
+    const uint8_t* root_ptr = source_ptr + 5;
+    const uint8_t* stream_ptr = root_ptr + (unsigned(source_ptr[4]) * 2) + 1;
+
+    // Codes up to 8 bits long are decoded with a single table lookup:
+    alignas(int) uint16_t table[256];
+    fill_huffman_table(root_ptr, root_ptr, 0, 0, table);
+
+    huffman_reader reader(reinterpret_cast<const uint32_t*>(stream_ptr));
+
+    while(destination_ptr < destination_end)
+    {
+        unsigned word = 0;
+
+        for(unsigned shift = 0; shift < 32; shift += data_size)
+        {
+            unsigned entry = table[reader.peek_byte()];
+            unsigned symbol;
+
+            if(entry & 0x8000) [[unlikely]]
+            {
+                reader.consume(8);
+
+                const uint8_t* node_ptr = root_ptr + (entry & 0x1FF);
+
+                while(true)
+                {
+                    unsigned node = *node_ptr;
+                    unsigned bit = reader.bit();
+                    node_ptr = huffman_child(node_ptr, node, bit);
+
+                    if(node & (0x80 >> bit))
+                    {
+                        symbol = *node_ptr;
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                reader.consume(entry >> 8);
+                symbol = entry & 0xFF;
+            }
+
+            word |= symbol << shift;
+        }
+
+        *destination_ptr++ = word;
+    }
+}
+
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "../include/bn_hw_hblank_effects.h"
+
+#if BN_CFG_HBES_SPARSE_MAX_LINES
+
+namespace bn::hw::hblank_effects
+{
+
+void _sparse_intr()
+{
+    _intr();
+
+    int vcount = REG_VCOUNT;
+    int line = vcount < display::height() - 1 ? vcount + 1 : 0;
+    int next_change_line = data->next_change_lines[line];
+
+    if(next_change_line != line + 1)
+    {
+        // Sleep until the line before the next change (or until the end of the frame if there's no more changes):
+        // The H-Blank interrupt is disabled in DISPSTAT instead of in IE, since IE is also modified by main code:
+        int next_vcount = next_change_line ? next_change_line - 1 : last_vcount();
+        REG_DISPSTAT = (REG_DISPSTAT & ~(DSTAT_HBL_IRQ | DSTAT_VCT_MASK)) | DSTAT_VCT(next_vcount);
+    }
+}
+
+void _vcount_intr()
+{
+    REG_DISPSTAT = REG_DISPSTAT | DSTAT_HBL_IRQ;
+}
+
+}
+
+#endif
@@ -18,6 +18,7 @@
     #include "bn_core.h"
     #include "bn_vector.h"
     #include "bn_keypad.h"
+    #include "bn_timers.h"
     #include "bn_profiler.h"
     #include "bn_unordered_map.h"
 #endif
@@ -138,25 +139,60 @@ namespace
         else
         {
             // Collect entries:
+            enum mode
+            {
+                TOTAL,
+                SELF,
+                MAX,
+                P50,
+                P95,
+                P99,
+                MODES_COUNT
+            };
+
+            constexpr const char* mode_titles[MODES_COUNT] = {
+                "PROFILER results - TOTAL ticks",
+                "PROFILER results - SELF ticks",
+                "PROFILER results - MAX ticks",
+                "PROFILER results - P50 frame ticks",
+                "PROFILER results - P95 frame ticks",
+                "PROFILER results - P99 frame ticks",
+            };
+
             struct entry
             {
                 string_view id;
-                int64_t total_ticks;
-                int max_ticks;
+                int64_t ticks[MODES_COUNT];
             };
 
             vector<entry, BN_CFG_PROFILER_MAX_ENTRIES * 2> entries;
-            int64_t total_ticks = 0;
-            int64_t max_ticks = 0;
-            bool show_total = true;
+            int64_t global_ticks[MODES_COUNT] = {};
+            int mode = TOTAL;
             bool rebuild = true;
 
+            for(int mode_index = MAX; mode_index < MODES_COUNT; ++mode_index)
+            {
+                global_ticks[mode_index] = timers::ticks_per_frame();
+            }
+
             for(const auto& ticks_per_entry_pair : ticks_per_entry)
             {
                 auto& ticks_entry = ticks_per_entry_pair.second;
-                entries.push_back({ ticks_per_entry_pair.first, ticks_entry.total, ticks_entry.max });
-                total_ticks += ticks_entry.total;
-                max_ticks = bn::max(max_ticks, int64_t(ticks_entry.max));
+                entries.push_back({ ticks_per_entry_pair.first, {
+                    ticks_entry.total,
+                    ticks_entry.self_total,
+                    ticks_entry.max,
+                    _bn::profiler::percentile_ticks(ticks_entry, 50),
+                    _bn::profiler::percentile_ticks(ticks_entry, 95),
+                    _bn::profiler::percentile_ticks(ticks_entry, 99),
+                } });
+
+                if(! ticks_entry.parent_id)
+                {
+                    global_ticks[TOTAL] += ticks_entry.total;
+                }
+
+                global_ticks[SELF] += ticks_entry.self_total;
             }
 
             // Retrieve max width for indexes, labels and ticks:
@@ -185,18 +221,9 @@ namespace
                     current_index = 0;
 
                     // Sort entries by ticks (higher to lower):
-                    if(show_total)
-                    {
-                        sort(entries.begin(), entries.end(), [](const entry& a, const entry& b) {
-                            return a.total_ticks > b.total_ticks;
-                        });
-                    }
-                    else
-                    {
-                        sort(entries.begin(), entries.end(), [](const entry& a, const entry& b) {
-                            return a.max_ticks > b.max_ticks;
-                        });
-                    }
+                    sort(entries.begin(), entries.end(), [mode](const entry& a, const entry& b) {
+                        return a.ticks[mode] > b.ticks[mode];
+                    });
 
                     // Calculate columns width:
                     for(int index = 0; index < num_entries; ++index)
@@ -211,7 +238,7 @@ namespace
                         max_id_width = max(max_id_width, int(tte_get_text_size(buffer_stream.str().c_str()).x));
 
                         buffer.clear();
-                        buffer_stream << (show_total ? entry.total_ticks : entry.max_ticks);
+                        buffer_stream << entry.ticks[mode];
                         max_ticks_width = max(max_ticks_width, int(tte_get_text_size(buffer_stream.str().c_str()).x));
                     }
 
@@ -219,20 +246,10 @@ namespace
                 }
 
                 // Print title:
-                int64_t global_var;
+                int64_t global_var = global_ticks[mode];
                 tte_set_pos(init_x, init_y);
                 tte_set_ink(colors::green.data());
-
-                if(show_total)
-                {
-                    tte_write("PROFILER results - TOTAL ticks");
-                    global_var = total_ticks;
-                }
-                else
-                {
-                    tte_write("PROFILER results - MAX ticks");
-                    global_var = max_ticks;
-                }
+                tte_write(mode_titles[mode]);
 
                 if(num_entries > max_visible_entries)
                 {
@@ -270,7 +287,7 @@ namespace
                     tte_set_pos(x + max_id_width + margin, y);
                     tte_get_pos(&x, &y);
 
-                    int64_t entry_var = show_total ? entry.total_ticks : entry.max_ticks;
+                    int64_t entry_var = entry.ticks[mode];
                     buffer.clear();
                     buffer_stream << entry_var;
                     tte_set_ink(colors::yellow.data());
@@ -296,7 +313,7 @@ namespace
 
                     if(keypad::a_pressed())
                     {
-                        show_total = ! show_total;
+                        mode = (mode + 1) % MODES_COUNT;
                         rebuild = true;
                         tte_erase_screen();
                         break;
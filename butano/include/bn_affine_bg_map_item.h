@@ -110,8 +110,14 @@ public:
     /**
      * @brief Indicates if maps generated with this item are big or not.
      *
-     * Big backgrounds are slower CPU wise and don't support wrapping
-     * (they can't be moved beyond their boundaries), but can have any width or height multiple of 256 pixels.
+     * Big backgrounds are slower CPU wise, but can have any width or height multiple of 256 pixels.
+     *
+     * Compressed big maps are split in 32x32 cells chunks which are decompressed on demand:
+     * the referenced data starts with the offset in bytes of each chunk (one 32 bits value per chunk,
+     * in row-major order), followed by the compressed data of each chunk.
+     *
+     * Compressed big maps are disabled unless @ref BN_CFG_BG_BLOCKS_AFFINE_BIG_MAP_CHUNKS_CACHE_SIZE
+     * is greater than zero: otherwise, creating a compressed big map triggers an assert.
      */
     [[nodiscard]] constexpr bool big() const
     {
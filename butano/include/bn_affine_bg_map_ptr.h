@@ -266,8 +266,7 @@ public:
     /**
      * @brief Indicates if this map is big or not.
      *
-     * Big backgrounds are slower CPU wise and don't support wrapping
-     * (they can't be moved beyond their boundaries), but can have any width or height multiple of 256 pixels.
+     * Big backgrounds are slower CPU wise, but can have any width or height multiple of 256 pixels.
      */
     [[nodiscard]] bool big() const;
 
@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_AFFINE_BG_PERSPECTIVE_PLANE_H
+#define BN_AFFINE_BG_PERSPECTIVE_PLANE_H
+
+/**
+ * @file
+ * bn::affine_bg_perspective_plane header file.
+ *
+ * @ingroup affine_bg
+ * @ingroup hdma
+ */
+
+#include "bn_display.h"
+#include "bn_affine_bg_ptr.h"
+
+namespace bn
+{
+
+/**
+ * @brief Draws an affine background as a floor seen in perspective (also known as mode 7).
+ *
+ * The affine registers of the background are written in each screen line with HDMA.
+ * Like bn::hdma_stream, it reserves a DMA channel while it is alive,
+ * so bn::hdma and H-Blank effects can't use it.
+ *
+ * Screen lines above the horizon don't show the background if its wrapping is disabled.
+ *
+ * It contains two tables of 2560 bytes each, so avoid placing it in the stack.
+ *
+ * @ingroup affine_bg
+ * @ingroup hdma
+ */
+class affine_bg_perspective_plane
+{
+
+public:
+    /**
+     * @brief Constructor.
+     * @param bg Affine background to draw.
+     * @param horizon_line Screen line of the horizon (negative if it is above the screen).
+     * @param focal_length Distance in pixels from the camera to the screen (it sets the field of view).
+     */
+    explicit affine_bg_perspective_plane(affine_bg_ptr bg, int horizon_line = 0, int focal_length = 160);
+
+    affine_bg_perspective_plane(const affine_bg_perspective_plane& other) = delete;
+
+    affine_bg_perspective_plane& operator=(const affine_bg_perspective_plane& other) = delete;
+
+    /**
+     * @brief Destructor.
+     *
+     * It stops writing the affine registers and releases the reserved DMA channel immediately.
+     */
+    ~affine_bg_perspective_plane();
+
+    /**
+     * @brief Returns the affine background to draw.
+     */
+    [[nodiscard]] const affine_bg_ptr& bg() const
+    {
+        return _bg;
+    }
+
+    /**
+     * @brief Returns the horizontal position of the camera in background map pixels.
+     */
+    [[nodiscard]] fixed camera_x() const
+    {
+        return _camera_x;
+    }
+
+    /**
+     * @brief Sets the horizontal position of the camera in background map pixels.
+     */
+    void set_camera_x(fixed camera_x);
+
+    /**
+     * @brief Returns the height of the camera over the background in pixels.
+     */
+    [[nodiscard]] fixed camera_height() const
+    {
+        return _camera_height;
+    }
+
+    /**
+     * @brief Sets the height of the camera over the background in pixels.
+     */
+    void set_camera_height(fixed camera_height);
+
+    /**
+     * @brief Returns the vertical position of the camera in background map pixels.
+     */
+    [[nodiscard]] fixed camera_z() const
+    {
+        return _camera_z;
+    }
+
+    /**
+     * @brief Sets the vertical position of the camera in background map pixels.
+     */
+    void set_camera_z(fixed camera_z);
+
+    /**
+     * @brief Sets the position of the camera.
+     * @param camera_x Horizontal position of the camera in background map pixels.
+     * @param camera_height Height of the camera over the background in pixels.
+     * @param camera_z Vertical position of the camera in background map pixels.
+     */
+    void set_camera_position(fixed camera_x, fixed camera_height, fixed camera_z);
+
+    /**
+     * @brief Returns the yaw angle of the camera in degrees, in the range [0..360].
+     */
+    [[nodiscard]] fixed camera_yaw() const
+    {
+        return _camera_yaw;
+    }
+
+    /**
+     * @brief Sets the yaw angle of the camera in degrees, in the range [0..360].
+     */
+    void set_camera_yaw(fixed camera_yaw);
+
+    /**
+     * @brief Returns the screen line of the horizon.
+     *
+     * Moving the horizon up or down tilts the camera (pitch).
+     */
+    [[nodiscard]] int horizon_line() const
+    {
+        return _horizon_line;
+    }
+
+    /**
+     * @brief Sets the screen line of the horizon (negative if it is above the screen).
+     *
+     * Moving the horizon up or down tilts the camera (pitch).
+     */
+    void set_horizon_line(int horizon_line);
+
+    /**
+     * @brief Returns the distance in pixels from the camera to the screen.
+     *
+     * The greater the distance, the narrower the field of view.
+     */
+    [[nodiscard]] int focal_length() const
+    {
+        return _focal_length;
+    }
+
+    /**
+     * @brief Sets the distance in pixels from the camera to the screen.
+     *
+     * The greater the distance, the narrower the field of view.
+     */
+    void set_focal_length(int focal_length);
+
+    /**
+     * @brief Regenerates the affine registers of each screen line if the camera has changed
+     * and starts writing them with HDMA.
+     *
+     * It should be called once per frame, before bn::core::update.
+     */
+    void update();
+
+private:
+    class row
+    {
+
+    public:
+        int16_t pa;
+        int16_t pb;
+        int16_t pc;
+        int16_t pd;
+        int dx;
+        int dy;
+    };
+
+    static_assert(sizeof(row) == 16);
+
+    row _rows[2][display::height()];
+    affine_bg_ptr _bg;
+    fixed _camera_x;
+    fixed _camera_height = 32;
+    fixed _camera_z;
+    fixed _camera_yaw;
+    int _horizon_line;
+    int _focal_length;
+    int8_t _channel_index;
+    int8_t _hw_id = -1;
+    int8_t _rows_index = 0;
+    bool _regenerate = true;
+
+    BN_CODE_IWRAM void _generate_rows(int sin, int cos, row* rows) const;
+};
+
+}
+
+#endif
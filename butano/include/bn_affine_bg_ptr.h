@@ -193,8 +193,7 @@ public:
     /**
      * @brief Indicates if this affine background is big or not.
      *
-     * Big backgrounds are slower CPU wise and don't support wrapping
-     * (they can't be moved beyond their boundaries), but can have any width or height multiple of 256 pixels.
+     * Big backgrounds are slower CPU wise, but can have any width or height multiple of 256 pixels.
      */
     [[nodiscard]] bool big() const;
 
@@ -306,8 +305,6 @@ public:
 
     /**
      * @brief Sets the horizontal position of the affine background (relative to its camera, if it has one).
-     *
-     * Remember that big backgrounds don't support wrapping (they can't be moved beyond their boundaries).
      */
     void set_x(fixed x);
 
@@ -318,8 +315,6 @@ public:
 
     /**
      * @brief Sets the vertical position of the affine background (relative to its camera, if it has one).
-     *
-     * Remember that big backgrounds don't support wrapping (they can't be moved beyond their boundaries).
      */
     void set_y(fixed y);
 
@@ -331,8 +326,6 @@ public:
     /**
      * @brief Sets the position of the affine background (relative to its camera, if it has one).
      *
-     * Remember that big backgrounds don't support wrapping (they can't be moved beyond their boundaries).
-     *
      * @param x Horizontal position of the affine background (relative to its camera, if it has one).
      * @param y Vertical position of the affine background (relative to its camera, if it has one).
      */
@@ -340,8 +333,6 @@ public:
 
     /**
      * @brief Sets the position of the affine background (relative to its camera, if it has one).
-     *
-     * Remember that big backgrounds don't support wrapping (they can't be moved beyond their boundaries).
      */
     void set_position(const fixed_point& position);
 
@@ -340,6 +340,46 @@ public:
         _pd = int16_t(pd);
     }
 
+    /**
+     * @brief Returns a copy of this affine_mat_attributes with its rotation angle and scale
+     * rounded to the nearest multiple of the given steps.
+     *
+     * Quantized attributes are more likely to share the same GBA register values,
+     * so they help to reduce the number of used affine transformation matrices.
+     *
+     * @param rotation_angle_step Rotation angle step in degrees (0 to keep the rotation angle as it is).
+     * @param scale_step Horizontal and vertical scale step (0 to keep the scale as it is).
+     * @return Quantized affine_mat_attributes.
+     */
+    [[nodiscard]] constexpr affine_mat_attributes quantized(fixed rotation_angle_step, fixed scale_step) const
+    {
+        BN_ASSERT(rotation_angle_step >= 0, "Invalid rotation angle step: ", rotation_angle_step);
+        BN_ASSERT(scale_step >= 0, "Invalid scale step: ", scale_step);
+
+        affine_mat_attributes result = *this;
+
+        if(rotation_angle_step > 0)
+        {
+            fixed rotation_angle = rotation_angle_step * (_rotation_angle / rotation_angle_step).round_integer();
+
+            if(rotation_angle >= 360)
+            {
+                rotation_angle -= 360;
+            }
+
+            result.set_rotation_angle(rotation_angle);
+        }
+
+        if(scale_step > 0)
+        {
+            fixed horizontal_scale = scale_step * (_horizontal_scale / scale_step).round_integer();
+            fixed vertical_scale = scale_step * (_vertical_scale / scale_step).round_integer();
+            result.set_scale(max(horizontal_scale, scale_step), max(vertical_scale, scale_step));
+        }
+
+        return result;
+    }
+
     /**
      * @brief Equal operator.
      * @param a First affine_mat_attributes to compare.
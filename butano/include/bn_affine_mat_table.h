@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_AFFINE_MAT_TABLE_H
+#define BN_AFFINE_MAT_TABLE_H
+
+/**
+ * @file
+ * bn::affine_mat_table header file.
+ *
+ * @ingroup affine_mat
+ */
+
+#include "bn_affine_mat_attributes.h"
+
+namespace bn
+{
+
+/**
+ * @brief Table of affine_mat_attributes covering evenly spaced rotation angles and scales.
+ *
+ * It should be built at compile time (declared as `constexpr`), so sines, cosines and register values
+ * are not calculated at runtime: installing one of its entries into a sprite_affine_mat_ptr or an affine_bg_ptr
+ * with their set_attributes and set_mat_attributes methods only copies it.
+ *
+ * Each entry takes 40 bytes of ROM.
+ *
+ * @tparam RotationSteps Number of rotation angles in the range [0..360).
+ * @tparam ScaleSteps Number of scales in the range [min_scale..max_scale].
+ *
+ * @ingroup affine_mat
+ */
+template<int RotationSteps, int ScaleSteps = 1>
+class affine_mat_table
+{
+    static_assert(RotationSteps > 0);
+    static_assert(ScaleSteps > 0);
+
+public:
+    /**
+     * @brief Constructor.
+     * @param min_scale Scale of the first scale step.
+     * @param max_scale Scale of the last scale step.
+     */
+    constexpr explicit affine_mat_table(fixed min_scale = 1, fixed max_scale = 1) :
+        _min_scale(min_scale),
+        _max_scale(max_scale)
+    {
+        BN_ASSERT(min_scale > 0, "Invalid min scale: ", min_scale);
+        BN_ASSERT(max_scale >= min_scale, "Invalid max scale: ", min_scale, " - ", max_scale);
+
+        for(int rotation_index = 0; rotation_index < RotationSteps; ++rotation_index)
+        {
+            fixed rotation = rotation_angle(rotation_index);
+
+            for(int scale_index = 0; scale_index < ScaleSteps; ++scale_index)
+            {
+                affine_mat_attributes& attributes = _attributes[(rotation_index * ScaleSteps) + scale_index];
+                attributes.set_rotation_angle(rotation);
+                attributes.set_scale(scale(scale_index));
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of rotation angles.
+     */
+    [[nodiscard]] constexpr static int rotation_steps()
+    {
+        return RotationSteps;
+    }
+
+    /**
+     * @brief Returns the number of scales.
+     */
+    [[nodiscard]] constexpr static int scale_steps()
+    {
+        return ScaleSteps;
+    }
+
+    /**
+     * @brief Returns the scale of the first scale step.
+     */
+    [[nodiscard]] constexpr fixed min_scale() const
+    {
+        return _min_scale;
+    }
+
+    /**
+     * @brief Returns the scale of the last scale step.
+     */
+    [[nodiscard]] constexpr fixed max_scale() const
+    {
+        return _max_scale;
+    }
+
+    /**
+     * @brief Returns the rotation angle in degrees of the given rotation step.
+     */
+    [[nodiscard]] constexpr static fixed rotation_angle(int rotation_index)
+    {
+        BN_ASSERT(rotation_index >= 0 && rotation_index < RotationSteps, "Invalid rotation index: ", rotation_index);
+
+        return fixed::from_data(int((int64_t(fixed(360).data()) * rotation_index) / RotationSteps));
+    }
+
+    /**
+     * @brief Returns the scale of the given scale step.
+     */
+    [[nodiscard]] constexpr fixed scale(int scale_index) const
+    {
+        BN_ASSERT(scale_index >= 0 && scale_index < ScaleSteps, "Invalid scale index: ", scale_index);
+
+        if constexpr(ScaleSteps == 1)
+        {
+            return _min_scale;
+        }
+        else
+        {
+            int scale_range = (_max_scale - _min_scale).data();
+            return _min_scale + fixed::from_data((scale_range * scale_index) / (ScaleSteps - 1));
+        }
+    }
+
+    /**
+     * @brief Returns the index of the rotation step closest to the given rotation angle.
+     * @param rotation_angle Rotation angle in degrees, in the range [0..360].
+     */
+    [[nodiscard]] constexpr static int rotation_index(fixed rotation_angle)
+    {
+        BN_ASSERT(rotation_angle >= 0 && rotation_angle <= 360, "Invalid rotation angle: ", rotation_angle);
+
+        int result = int(((int64_t(rotation_angle.data()) * RotationSteps) + (fixed(180).data())) / fixed(360).data());
+        return result == RotationSteps ? 0 : result;
+    }
+
+    /**
+     * @brief Returns the index of the scale step closest to the given scale.
+     */
+    [[nodiscard]] constexpr int scale_index(fixed scale) const
+    {
+        if constexpr(ScaleSteps == 1)
+        {
+            return 0;
+        }
+        else
+        {
+            if(scale <= _min_scale)
+            {
+                return 0;
+            }
+
+            if(scale >= _max_scale)
+            {
+                return ScaleSteps - 1;
+            }
+
+            int scale_range = (_max_scale - _min_scale).data();
+            int scale_offset = (scale - _min_scale).data();
+            return ((scale_offset * (ScaleSteps - 1)) + (scale_range / 2)) / scale_range;
+        }
+    }
+
+    /**
+     * @brief Returns the affine_mat_attributes of the given rotation and scale steps.
+     */
+    [[nodiscard]] constexpr const affine_mat_attributes& attributes(int rotation_index, int scale_index = 0) const
+    {
+        BN_ASSERT(rotation_index >= 0 && rotation_index < RotationSteps, "Invalid rotation index: ", rotation_index);
+        BN_ASSERT(scale_index >= 0 && scale_index < ScaleSteps, "Invalid scale index: ", scale_index);
+
+        return _attributes[(rotation_index * ScaleSteps) + scale_index];
+    }
+
+    /**
+     * @brief Returns the affine_mat_attributes closest to the given rotation angle and scale.
+     * @param rotation_angle Rotation angle in degrees, in the range [0..360].
+     * @param scale Scale.
+     */
+    [[nodiscard]] constexpr const affine_mat_attributes& closest_attributes(fixed rotation_angle, fixed scale = 1) const
+    {
+        return _attributes[(rotation_index(rotation_angle) * ScaleSteps) + scale_index(scale)];
+    }
+
+private:
+    fixed _min_scale;
+    fixed _max_scale;
+    affine_mat_attributes _attributes[RotationSteps * ScaleSteps];
+};
+
+}
+
+#endif
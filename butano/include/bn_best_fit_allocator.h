@@ -23,6 +23,9 @@ namespace bn
 /**
  * @brief Manages a chunk of memory with a best fit allocation strategy.
  *
+ * Free items are stored in segregated lists: small items have a list per exact size,
+ * and the bigger ones have a list per power of two size class.
+ *
  * @ingroup allocator
  */
 class best_fit_allocator
@@ -221,9 +224,12 @@ private:
 
     static constexpr size_type _sizeof_free_item = sizeof(item_type);
     static constexpr size_type _sizeof_used_item = sizeof(item_type) - sizeof(free_items_pair);
+    static constexpr size_type _exact_bins_count = 12;
+    static constexpr size_type _bins_count = 32;
 
     uint8_t* _start_ptr = nullptr;
-    item_type* _first_free_item = nullptr;
+    item_type* _free_items_bins[_bins_count] = {};
+    unsigned _free_items_bins_mask = 0;
     size_type _total_bytes_count = 0;
     size_type _free_bytes_count = 0;
 
@@ -247,6 +253,12 @@ private:
         return reinterpret_cast<item_type*>(_start_ptr + _total_bytes_count);
     }
 
+    [[nodiscard]] static size_type _bin_index(size_type bytes);
+
+    void _insert_free_item(item_type* item);
+
+    void _erase_free_item(item_type* item);
+
     [[nodiscard]] item_type* _best_free_item(size_type bytes);
 
     #if BN_CFG_BEST_FIT_ALLOCATOR_SANITY_CHECK_ENABLED
@@ -28,7 +28,8 @@ enum class compression_type : uint8_t
     NONE, //!< Uncompressed data.
     LZ77, //!< LZ77 compressed data.
     RUN_LENGTH, //!< Run-length compressed data.
-    HUFFMAN //!< Huffman compressed data.
+    HUFFMAN, //!< Huffman compressed data.
+    LZ4 //!< LZ4 like compressed data tuned for decompression speed (it's not compatible with the LZ4 format).
 };
 
 }
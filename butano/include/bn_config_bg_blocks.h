@@ -26,6 +26,78 @@
     #define BN_CFG_BG_BLOCKS_MAX_ITEMS 16
 #endif
 
+/**
+ * @def BN_CFG_BG_BLOCKS_REGULAR_BIG_MAP_CHUNKS_CACHE_SIZE
+ *
+ * Specifies the maximum number of decompressed 32x32 cells chunks of compressed regular big maps
+ * that can be stored in EWRAM at the same time.
+ *
+ * If it is zero (the default), compressed regular big maps are disabled and they don't take any memory:
+ * creating a compressed regular big map triggers an assert.
+ *
+ * Otherwise, it must be at least two, since a row or column commit can read from two chunks.
+ * Each chunk takes 2KB.
+ *
+ * When a big map is scrolled, the committed area (32x22 cells) can span four chunks,
+ * so a cache with four chunks or more avoids decompressing the same chunks again when scrolling diagonally.
+ *
+ * @ingroup bg
+ */
+#ifndef BN_CFG_BG_BLOCKS_REGULAR_BIG_MAP_CHUNKS_CACHE_SIZE
+    #define BN_CFG_BG_BLOCKS_REGULAR_BIG_MAP_CHUNKS_CACHE_SIZE 0
+#endif
+
+/**
+ * @def BN_CFG_BG_BLOCKS_AFFINE_BIG_MAP_CHUNKS_CACHE_SIZE
+ *
+ * Specifies the maximum number of decompressed 32x32 cells chunks of compressed affine big maps
+ * that can be stored in EWRAM at the same time.
+ *
+ * If it is zero (the default), compressed affine big maps are disabled and they don't take any memory:
+ * creating a compressed affine big map triggers an assert.
+ *
+ * Otherwise, it must be at least two, since a row or column commit can read from two chunks.
+ * Each chunk takes 1KB.
+ *
+ * When a big map is scrolled, the committed area (32x22 cells) can span four chunks,
+ * so a cache with four chunks or more avoids decompressing the same chunks again when scrolling diagonally.
+ *
+ * @ingroup bg
+ */
+#ifndef BN_CFG_BG_BLOCKS_AFFINE_BIG_MAP_CHUNKS_CACHE_SIZE
+    #define BN_CFG_BG_BLOCKS_AFFINE_BIG_MAP_CHUNKS_CACHE_SIZE 0
+#endif
+
+/**
+ * @def BN_CFG_BG_BLOCKS_STREAMED_TILES_COUNT
+ *
+ * Specifies the number of VRAM tiles reserved by the regular BG map with streamed tiles
+ * (see bn::regular_bg_map_ptr::create_streamed).
+ *
+ * If it is zero, regular BG maps with streamed tiles are disabled and they don't take any memory.
+ *
+ * Otherwise, besides the VRAM tiles, streamed tiles take 2KB of EWRAM plus up to 28 bytes per tile.
+ *
+ * @ingroup bg
+ */
+#ifndef BN_CFG_BG_BLOCKS_STREAMED_TILES_COUNT
+    #define BN_CFG_BG_BLOCKS_STREAMED_TILES_COUNT 0
+#endif
+
+/**
+ * @def BN_CFG_BG_BLOCKS_STREAMED_TILES_MAX_UPLOADS
+ *
+ * Specifies the maximum number of tiles that the regular BG map with streamed tiles
+ * can upload to VRAM per frame.
+ *
+ * Map cells whose tiles can't be uploaded in the current frame are committed in the next ones.
+ *
+ * @ingroup bg
+ */
+#ifndef BN_CFG_BG_BLOCKS_STREAMED_TILES_MAX_UPLOADS
+    #define BN_CFG_BG_BLOCKS_STREAMED_TILES_MAX_UPLOADS 64
+#endif
+
 /**
  * @def BN_CFG_BG_BLOCKS_LOG_ENABLED
  *
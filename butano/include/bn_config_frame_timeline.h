@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_CONFIG_FRAME_TIMELINE_H
+#define BN_CONFIG_FRAME_TIMELINE_H
+
+/**
+ * @file
+ * Frame timeline configuration header file.
+ *
+ * @ingroup profiler
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_CFG_FRAME_TIMELINE_ENABLED
+ *
+ * Specifies if the frame timeline recorder is enabled or not.
+ *
+ * Unlike the profiler, it has a very low overhead, so it can be enabled in release builds.
+ *
+ * @ingroup profiler
+ */
+#ifndef BN_CFG_FRAME_TIMELINE_ENABLED
+    #define BN_CFG_FRAME_TIMELINE_ENABLED false
+#endif
+
+/**
+ * @def BN_CFG_FRAME_TIMELINE_MAX_FRAMES
+ *
+ * Specifies the maximum number of frames stored by the frame timeline recorder.
+ *
+ * When it is full, the oldest frame is discarded.
+ *
+ * @ingroup profiler
+ */
+#ifndef BN_CFG_FRAME_TIMELINE_MAX_FRAMES
+    #define BN_CFG_FRAME_TIMELINE_MAX_FRAMES 64
+#endif
+
+#endif
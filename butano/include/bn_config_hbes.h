@@ -23,10 +23,56 @@
  *
  * Specifies the maximum number of active H-Blank effects.
  *
+ * Up to 8 H-Blank effects can be handled by the H-Blank interrupt,
+ * so more than 8 of them can be active only if the rest are handled by HDMA
+ * (see @ref BN_CFG_HBES_MAX_HDMA_ITEMS).
+ *
+ * If more than 8 H-Blank effects are visible and bn::hdma is using the HDMA channels they would take,
+ * the ones that don't fit in the H-Blank interrupt are not shown until a channel is released.
+ *
  * @ingroup hblank_effect
  */
 #ifndef BN_CFG_HBES_MAX_ITEMS
     #define BN_CFG_HBES_MAX_ITEMS 6
 #endif
 
+/**
+ * @def BN_CFG_HBES_MAX_HDMA_ITEMS
+ *
+ * Specifies the maximum number of H-Blank effects that can be handled by HDMA channels
+ * instead of by the H-Blank interrupt (from 0 to 2).
+ *
+ * H-Blank effects only take the HDMA channels not used by bn::hdma nor by bn::hdma_stream
+ * (the low priority one first),
+ * so they are handled by the H-Blank interrupt when all of them are busy.
+ *
+ * The second channel is the high priority one, which can cause issues with audio.
+ *
+ * @ingroup hblank_effect
+ */
+#ifndef BN_CFG_HBES_MAX_HDMA_ITEMS
+    #define BN_CFG_HBES_MAX_HDMA_ITEMS 0
+#endif
+
+/**
+ * @def BN_CFG_HBES_SPARSE_MAX_LINES
+ *
+ * Specifies the maximum number of screen lines in which the values of the active H-Blank effects can change
+ * for them to be written only in these lines, instead of in all of them.
+ *
+ * In this sparse mode, a V-Count interrupt enables the H-Blank interrupt only before the lines that change,
+ * so split-screen effects and parallax bands with a few horizontal strips take much less CPU.
+ *
+ * The sparse mode takes the V-Count interrupt, so it is disabled by default:
+ * if it is zero, H-Blank effects values are always written in all lines.
+ *
+ * It is also read by the interrupt handler assembly code,
+ * so it should be defined in USERFLAGS (or in USERASFLAGS too) instead of in a header file.
+ *
+ * @ingroup hblank_effect
+ */
+#ifndef BN_CFG_HBES_SPARSE_MAX_LINES
+    #define BN_CFG_HBES_SPARSE_MAX_LINES 0
+#endif
+
 #endif
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_CONFIG_HDMA_H
+#define BN_CONFIG_HDMA_H
+
+/**
+ * @file
+ * HDMA configuration header file.
+ *
+ * @ingroup hdma
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_CFG_HDMA_MAX_CHANNELS
+ *
+ * Specifies the maximum number of DMA channels that can be used for HDMA (2 or 3).
+ *
+ * DMA channels 3 (low priority) and 0 (high priority) are always available.
+ * If it is 3, DMA channel 2 is available too for bn::hdma_stream.
+ * Butano's audio doesn't use it, but other code which uses it must be aware of this.
+ *
+ * @ingroup hdma
+ */
+#ifndef BN_CFG_HDMA_MAX_CHANNELS
+    #define BN_CFG_HDMA_MAX_CHANNELS 3
+#endif
+
+#endif
@@ -42,6 +42,8 @@
  *
  * Specifies if each Butano subsystem must be profiled separately or not.
  *
+ * Each subsystem code block is nested in the general Butano code blocks.
+ *
  * @ref BN_CFG_PROFILER_LOG_ENGINE must be `true` to enable Butano subsystems profiling.
  *
  * @ingroup profiler
@@ -61,4 +63,28 @@
     #define BN_CFG_PROFILER_MAX_ENTRIES 64
 #endif
 
+/**
+ * @def BN_CFG_PROFILER_MAX_DEPTH
+ *
+ * Specifies the maximum number of code blocks that can be profiled at the same time (nested).
+ *
+ * @ingroup profiler
+ */
+#ifndef BN_CFG_PROFILER_MAX_DEPTH
+    #define BN_CFG_PROFILER_MAX_DEPTH 16
+#endif
+
+/**
+ * @def BN_CFG_PROFILER_HISTOGRAM_SIZE
+ *
+ * Specifies the number of buckets of the per frame histogram of each profiled code block.
+ *
+ * The last bucket stores the frames in which a code block took one frame or more.
+ *
+ * @ingroup profiler
+ */
+#ifndef BN_CFG_PROFILER_HISTOGRAM_SIZE
+    #define BN_CFG_PROFILER_HISTOGRAM_SIZE 16
+#endif
+
 #endif
@@ -27,6 +27,35 @@
     #define BN_CFG_SPRITE_TILES_MAX_ITEMS 128
 #endif
 
+/**
+ * @def BN_CFG_SPRITE_TILES_MAX_COMMIT_TILES_PER_FRAME
+ *
+ * Specifies the maximum number of sprite tiles that can be uploaded to VRAM in V-Blank in one frame.
+ *
+ * Tile sets that don't fit in this budget are uploaded in the next frames, in the same order they were requested.
+ *
+ * Keep in mind that sprites show outdated tiles until their tile set is uploaded.
+ *
+ * @ingroup sprite
+ */
+#ifndef BN_CFG_SPRITE_TILES_MAX_COMMIT_TILES_PER_FRAME
+    #define BN_CFG_SPRITE_TILES_MAX_COMMIT_TILES_PER_FRAME 1024
+#endif
+
+/**
+ * @def BN_CFG_SPRITE_TILES_MAX_CACHED_TILES
+ *
+ * Specifies the maximum number of tiles of unused sprite tile sets that are kept in VRAM,
+ * so they can be reused later without being uploaded again (useful for animations).
+ *
+ * When there's no more available VRAM, least recently used tile sets are removed first.
+ *
+ * @ingroup sprite
+ */
+#ifndef BN_CFG_SPRITE_TILES_MAX_CACHED_TILES
+    #define BN_CFG_SPRITE_TILES_MAX_CACHED_TILES 0
+#endif
+
 /**
  * @def BN_CFG_SPRITE_TILES_LOG_ENABLED
  *
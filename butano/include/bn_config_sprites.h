@@ -13,7 +13,11 @@
  * @ingroup sprite
  */
 
-#include "bn_common.h"
+#include "bn_sprites_overflow_mode.h"
+
+#ifdef BN_CFG_SPRITES_MAX_SORT_LAYERS
+    #error "BN_CFG_SPRITES_MAX_SORT_LAYERS has been removed: sprite sort layers are not limited anymore"
+#endif
 
 /**
  * @def BN_CFG_SPRITES_MAX_ITEMS
@@ -23,6 +27,8 @@
  * A sprite item which is outside of the screen or hidden is not committed to the GBA,
  * so there can be more than 128 sprite items.
  *
+ * The data checked each frame by all sprite items is stored in IWRAM (16 bytes per item).
+ *
  * @ingroup sprite
  */
 #ifndef BN_CFG_SPRITES_MAX_ITEMS
@@ -30,17 +36,61 @@
 #endif
 
 /**
- * @def BN_CFG_SPRITES_MAX_SORT_LAYERS
+ * @def BN_CFG_SPRITES_GRID_CELL_SIZE
+ *
+ * Specifies the size in pixels of the cells of the uniform grid used to cull sprites attached to a camera,
+ * or 0 to disable it.
+ *
+ * When a camera moves, only the sprites attached to it which are on screen
+ * or which are in a cell overlapping its viewport are updated and checked,
+ * so off-screen sprites of worlds much larger than the screen are skipped.
+ *
+ * It must be a power of two greater than or equal to 32.
+ *
+ * @ingroup sprite
+ */
+#ifndef BN_CFG_SPRITES_GRID_CELL_SIZE
+    #define BN_CFG_SPRITES_GRID_CELL_SIZE 0
+#endif
+
+/**
+ * @def BN_CFG_SPRITES_MULTIPLEXING_HANDLES
+ *
+ * Specifies the number of hardware sprite handles (the last ones of OAM) that can be rewritten each scanline
+ * with HDMA to show more than 128 sprites at the same time.
+ *
+ * When there are more on screen sprites than available handles, the remaining ones are sorted by their vertical
+ * position and assigned to these handles, so each handle can show multiple sprites
+ * which don't overlap vertically (at least one empty scanline is required between them).
+ *
+ * Multiplexed sprites are drawn below the other sprites with the same background priority,
+ * and they use the low priority HDMA channel, so bn::hdma::start can't be called while they are shown.
+ *
+ * Keep in mind that the affine matrices stored in the last OAM handles can't be modified with H-Blank effects
+ * while there are multiplexed sprites.
+ *
+ * @ingroup sprite
+ */
+#ifndef BN_CFG_SPRITES_MULTIPLEXING_HANDLES
+    #define BN_CFG_SPRITES_MULTIPLEXING_HANDLES 0
+#endif
+
+/**
+ * @def BN_CFG_SPRITES_OVERFLOW_MODE
+ *
+ * Specifies what happens when there are more on screen sprites than available hardware sprite handles.
+ *
+ * Values not specified in BN_SPRITES_OVERFLOW_MODE_* macros are not allowed.
  *
- * Specifies the maximum number of used sprite sort layers.
+ * If BN_CFG_SPRITES_MULTIPLEXING_HANDLES is greater than zero, the overflow mode applies to the multiplexed sprites
+ * which can't be assigned to a multiplexing handle: they are hidden instead of being rotated.
  *
- * Sprites are grouped in layers depending of their background priority and z order,
- * so to reduce memory usage and improve performance, please use as less unique z orders as possible.
+ * The number of on screen sprites not shown in the last frame can be retrieved with bn::sprites::dropped_items_count.
  *
  * @ingroup sprite
  */
-#ifndef BN_CFG_SPRITES_MAX_SORT_LAYERS
-    #define BN_CFG_SPRITES_MAX_SORT_LAYERS 16
+#ifndef BN_CFG_SPRITES_OVERFLOW_MODE
+    #define BN_CFG_SPRITES_OVERFLOW_MODE BN_SPRITES_OVERFLOW_MODE_ASSERT
 #endif
 
 #endif
@@ -259,7 +259,10 @@
  * which is how games like Chrono Trigger fills their menus with a color gradient.
  *
  * It differs from H-Blank effects in that multiple registers can be written by HDMA in each screen horizontal line,
- * but since there's only one DMA channel available, written registers must be consecutive.
+ * but since each DMA channel writes to one destination, written registers must be consecutive.
+ *
+ * bn::hdma_stream allows to use more than one DMA channel at the same time, with 16 or 32 bit units,
+ * and to write the next frame's values while the current ones are being copied.
  *
  * It is also lower level than H-Blank effects, so you should try with H-Blank effects first.
  *
@@ -345,6 +348,9 @@
  *
  * It allows to measure elapsed time between code blocks defined by the user.
  *
+ * Code blocks can be nested, and a per frame histogram of each code block is stored to retrieve
+ * frame time percentiles.
+ *
  * It can be enabled or disabled by overloading the definition of @a BN_CFG_PROFILER_ENABLED @a .
  */
 
@@ -1047,19 +1053,22 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  * * `"palette_compression"`: optional field which specifies the compression of the colors data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  * * `"compression"`: optional field which specifies the compression of the tiles and the colors data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  *
  * If the conversion process has finished successfully,
  * a bn::sprite_item should have been generated in the `build` folder.
@@ -1108,7 +1117,8 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  *
  * If the conversion process has finished successfully,
  * a bn::sprite_tiles_item should have been generated in the `build` folder.
@@ -1146,7 +1156,8 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  *
  * If the conversion process has finished successfully,
  * a bn::sprite_palette_item should have been generated in the `build` folder.
@@ -1167,8 +1178,7 @@
  *
  * An image file can contain only one regular background.
  * The size of a small regular background (which are faster) must be 256x256, 256x512, 512x256 or 512x512 pixels.
- * Big regular backgrounds are slower CPU wise and don't support wrapping (they can't be moved beyond their boundaries),
- * but can have any width or height multiple of 256 pixels.
+ * Big regular backgrounds are slower CPU wise, but can have any width or height multiple of 256 pixels.
  *
  * An example of the `*.json` files required for regular backgrounds is the following:
  *
@@ -1202,25 +1212,29 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  * * `"palette_compression"`: optional field which specifies the compression of the colors data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  * * `"map_compression"`: optional field which specifies the compression of the map data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
- *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"huffman"`: Huffman compressed data (not supported by big maps).
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  * * `"compression"`: optional field which specifies the compression of the tiles, the colors and the map data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  *
  * If the conversion process has finished successfully,
  * a bn::regular_bg_item should have been generated in the `build` folder.
@@ -1261,7 +1275,8 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  *
  * If the conversion process has finished successfully,
  * a bn::regular_bg_tiles_item should have been generated in the `build` folder.
@@ -1282,8 +1297,7 @@
  *
  * An image file can contain only one affine background.
  * The size of a small affine background (which are faster) must be 128x128, 256x256, 512x512 or 1024x1024 pixels.
- * Big affine backgrounds are slower CPU wise and don't support wrapping (they can't be moved beyond their boundaries),
- * but can have any width or height multiple of 256 pixels.
+ * Big affine backgrounds are slower CPU wise, but can have any width or height multiple of 256 pixels.
  *
  * An example of the `*.json` files required for affine backgrounds is the following:
  *
@@ -1304,25 +1318,29 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  * * `"palette_compression"`: optional field which specifies the compression of the colors data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  * * `"map_compression"`: optional field which specifies the compression of the map data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
- *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"huffman"`: Huffman compressed data (not supported by big maps).
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  * * `"compression"`: optional field which specifies the compression of the tiles, the colors and the map data:
  *   * `"none"`: uncompressed data (this is the default option).
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  *
  * If the conversion process has finished successfully,
  * a bn::affine_bg_item should have been generated in the `build` folder.
@@ -1358,7 +1376,8 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  *
  * If the conversion process has finished successfully,
  * a bn::affine_bg_tiles_item should have been generated in the `build` folder.
@@ -1397,7 +1416,8 @@
  *   * `"lz77"`: LZ77 compressed data.
  *   * `"run_length"`: run-length compressed data.
  *   * `"huffman"`: Huffman compressed data.
- *   * `"auto"`: uses the option which gives the smallest data size.
+ *   * `"lz4"`: LZ4 like compressed data, faster to decompress than the other options.
+ *   * `"auto"`: uses the option which gives the best balance between data size and decompression speed.
  *
  * If the conversion process has finished successfully,
  * a bn::bg_palette_item should have been generated in the `build` folder.
@@ -1898,16 +1918,6 @@
  * @section faq_backgrounds Backgrounds
  *
  *
- * @subsection faq_bg_wrapping Why some backgrounds don't allow wrapping?
- *
- * If you try to move a big background beyond its boundaries, an error message like this one should be displayed:
- *
- * @image html faq_bg_wrapping.png
- *
- * That's because big backgrounds don't allow wrapping, so if you are using a big background,
- * avoid moving it beyond its boundaries (or avoid using big backgrounds).
- *
- *
  * @subsection faq_big_background What's a big background?
  *
  * The GBA only supports some fixed sizes for background maps.
@@ -1915,8 +1925,7 @@
  * However, Butano allows to manage background maps with any size multiple of 256 pixels.
  * These special background maps and the backgrounds that display them are called big maps/backgrounds.
  *
- * Try to avoid big backgrounds whenever possible, because they are slower CPU wise and
- * don't support wrapping (they can't be moved beyond their boundaries).
+ * Try to avoid big backgrounds whenever possible, because they are slower CPU wise.
  *
  *
  * @subsection faq_regular_affine_background Why there are two types of backgrounds (regular and affine)?
@@ -2023,6 +2032,42 @@
  * @section changelog_13_2_0 13.2.0 (next release)
  *
  * * bn::core::last_missed_frames added.
+ * * Profiler code blocks can be nested.
+ * * Profiler shows self ticks and 50th, 95th and 99th percentile ticks per frame.
+ * * bn::profiler::log added.
+ * * Frame timeline recorder added (see bn::frame_timeline and @ref BN_CFG_FRAME_TIMELINE_ENABLED).
+ * * LZ77, run-length and Huffman decompression CPU usage reduced.
+ * * LZ4 like compression added (see bn::compression_type::LZ4).
+ * * Big backgrounds wrapping support added.
+ * * Compressed big maps support added (see bn::regular_bg_map_item::big and bn::affine_bg_map_item::big).
+ * * Big maps commit CPU usage reduced.
+ * * Regular BG maps with streamed tiles added (see bn::regular_bg_map_ptr::create_streamed).
+ * * Sprite tiles upload budget per frame can be specified with @ref BN_CFG_SPRITE_TILES_MAX_COMMIT_TILES_PER_FRAME.
+ * * Unused sprite tiles can be cached in VRAM with @ref BN_CFG_SPRITE_TILES_MAX_CACHED_TILES.
+ * * bn::best_fit_allocator (used by the heap manager) free items are stored in segregated lists,
+ *   so alloc and free CPU usage doesn't grow with fragmentation.
+ * * More than 128 sprites can be shown at the same time with @ref BN_CFG_SPRITES_MULTIPLEXING_HANDLES.
+ * * Sprites overflow mode can be specified with @ref BN_CFG_SPRITES_OVERFLOW_MODE.
+ * * bn::sprites::dropped_items_count added.
+ * * Sprites update CPU usage reduced.
+ * * bn::sprites::set_positions and bn::sprites::add_positions added.
+ * * Lightweight particle system added (see bn::particle_system and bn::particle_emitter).
+ * * Sprite sort layers limit removed (defining `BN_CFG_SPRITES_MAX_SORT_LAYERS` is an error now).
+ * * Sprites background priority and z order changes CPU usage reduced.
+ * * Sprites can be sorted by their vertical position automatically (see bn::sprite_ptr::set_y_sorted).
+ * * Off-screen sprites attached to a camera can be culled with a uniform grid (see @ref BN_CFG_SPRITES_GRID_CELL_SIZE).
+ * * Sprite affine mats with the same register values can be shared (see bn::sprite_affine_mat_ptr::find_or_create).
+ * * bn::affine_mat_attributes::quantized added.
+ * * Precalculated affine transformation matrices can be generated at compile time with bn::affine_mat_table.
+ * * H-Blank effects whose values change in a few lines only are written in these lines
+ *   (see @ref BN_CFG_HBES_SPARSE_MAX_LINES).
+ * * H-Blank effects can be handled by free HDMA channels (see @ref BN_CFG_HBES_MAX_HDMA_ITEMS
+ *   and bn::hbe_ptr::hdma), so more than 8 of them can be active at the same time.
+ * * H-Blank effect values generators added (see bn::sine_wave_hbe_values, bn::linear_gradient_hbe_values,
+ *   bn::perspective_hbe_values and bn::keyframes_hbe_values).
+ * * Affine BG perspective plane (mode 7) added (see bn::affine_bg_perspective_plane).
+ * * HDMA streams with more than one DMA channel, 32 bit units and a ring of tables added
+ *   (see bn::hdma_stream and @ref BN_CFG_HDMA_MAX_CHANNELS).
  * * bn::core::set_skip_frames accuracy improved.
  * * Wait for V-Blank improved.
  *
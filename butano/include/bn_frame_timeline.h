@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_FRAME_TIMELINE_H
+#define BN_FRAME_TIMELINE_H
+
+/**
+ * @file
+ * Frame timeline recorder header file.
+ *
+ * @ingroup profiler
+ */
+
+#include "bn_config_doxygen.h"
+#include "bn_config_frame_timeline.h"
+
+#if BN_CFG_FRAME_TIMELINE_ENABLED || BN_DOXYGEN
+    /**
+     * @brief Frame timeline recorder related functions.
+     *
+     * It stores the elapsed ticks of each Butano engine phase for the last
+     * @ref BN_CFG_FRAME_TIMELINE_MAX_FRAMES frames.
+     *
+     * Update phases ticks are relative to the start of the previous V-Blank (they include game logic time),
+     * and commit phases ticks are relative to the start of the current V-Blank.
+     *
+     * @ingroup profiler
+     */
+    namespace bn::frame_timeline
+    {
+        /**
+         * @brief Available engine phases.
+         */
+        enum class phase : uint8_t
+        {
+            CAMERAS_UPDATE,
+            SPRITES_UPDATE,
+            SPRITE_TILES_UPDATE,
+            BGS_UPDATE,
+            BG_BLOCKS_UPDATE,
+            PALETTES_UPDATE,
+            DISPLAY_UPDATE,
+            HBLANK_EFFECTS_UPDATE,
+            AUDIO_COMMANDS,
+            DISPLAY_COMMIT,
+            SPRITES_COMMIT,
+            BGS_COMMIT,
+            PALETTES_COMMIT,
+            SPRITE_TILES_UNCOMPRESSED_COMMIT,
+            BIG_MAPS_COMMIT,
+            HDMA_UPDATE,
+            HBLANK_EFFECTS_COMMIT,
+            SPRITE_TILES_COMPRESSED_COMMIT,
+            BG_BLOCKS_COMMIT,
+            VBLANK_CALLBACK,
+            AUDIO_COMMIT,
+            GPIO_COMMIT
+        };
+
+        /**
+         * @brief Returns the number of available engine phases.
+         */
+        [[nodiscard]] constexpr int phases_count()
+        {
+            return int(phase::GPIO_COMMIT) + 1;
+        }
+
+        /**
+         * @brief Returns a small text string which identifies the given engine phase.
+         */
+        [[nodiscard]] const char* phase_name(phase phase);
+    }
+
+    /// @cond DO_NOT_DOCUMENT
+
+    namespace _bn::frame_timeline
+    {
+        void set_phase_end_ticks(bn::frame_timeline::phase phase, int ticks);
+
+        void commit_frame(int cpu_usage_ticks, int vblank_usage_ticks, int missed_frames);
+    }
+
+    /// @endcond
+
+    namespace bn::frame_timeline
+    {
+        /**
+         * @brief Timings of a recorded frame.
+         */
+        class frame
+        {
+
+        public:
+            /**
+             * @brief Returns the number of this frame since the recorder was cleared.
+             */
+            [[nodiscard]] unsigned number() const
+            {
+                return _number;
+            }
+
+            /**
+             * @brief Returns the number of frames missed before the commit phases of this frame.
+             */
+            [[nodiscard]] int missed_frames() const
+            {
+                return _missed_frames;
+            }
+
+            /**
+             * @brief Returns the elapsed ticks since the start of the previous V-Blank until the end of the
+             * update phases.
+             */
+            [[nodiscard]] int cpu_usage_ticks() const
+            {
+                return _cpu_usage_ticks;
+            }
+
+            /**
+             * @brief Returns the elapsed ticks since the start of the current V-Blank until the end of the
+             * V-Blank callback.
+             */
+            [[nodiscard]] int vblank_usage_ticks() const
+            {
+                return _vblank_usage_ticks;
+            }
+
+            /**
+             * @brief Returns the elapsed ticks until the end of the given phase.
+             *
+             * The start of a phase is the end of the previous one.
+             */
+            [[nodiscard]] int phase_end_ticks(phase phase) const
+            {
+                return _phase_end_ticks[int(phase)];
+            }
+
+        private:
+            unsigned _number = 0;
+            uint16_t _phase_end_ticks[phases_count()] = {};
+            uint16_t _cpu_usage_ticks = 0;
+            uint16_t _vblank_usage_ticks = 0;
+            uint16_t _missed_frames = 0;
+
+            friend void _bn::frame_timeline::set_phase_end_ticks(bn::frame_timeline::phase, int);
+
+            friend void _bn::frame_timeline::commit_frame(int, int, int);
+        };
+
+        /**
+         * @brief Returns the number of recorded frames.
+         */
+        [[nodiscard]] int frames_count();
+
+        /**
+         * @brief Returns the recorded frame at the given index (0 is the oldest recorded frame).
+         */
+        [[nodiscard]] const frame& frame_at(int index);
+
+        /**
+         * @brief Discards all recorded frames.
+         */
+        void clear();
+
+        /**
+         * @brief Prints the recorded frames as CSV rows with BN_LOG.
+         */
+        void log_csv();
+
+        /**
+         * @brief Prints the recorded frames as hexadecimal encoded binary rows with BN_LOG.
+         *
+         * Each row contains the little-endian representation of a bn::frame_timeline::frame
+         * (number as uint32_t, phase end ticks, CPU usage ticks, V-Blank usage ticks and missed frames as uint16_t).
+         */
+        void log_binary();
+    }
+#endif
+
+#endif
@@ -55,6 +55,13 @@ public:
      */
     void set_visible(bool visible);
 
+    /**
+     * @brief Indicates if this H-Blank effect is handled by an HDMA channel instead of by the H-Blank interrupt.
+     *
+     * It is updated in each bn::core::update call (see @ref BN_CFG_HBES_MAX_HDMA_ITEMS).
+     */
+    [[nodiscard]] bool hdma() const;
+
     /**
      * @brief Default equal operator.
      */
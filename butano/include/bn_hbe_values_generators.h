@@ -0,0 +1,431 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_HBE_VALUES_GENERATORS_H
+#define BN_HBE_VALUES_GENERATORS_H
+
+/**
+ * @file
+ * H-Blank effect values generators header file.
+ *
+ * @ingroup hblank_effect
+ */
+
+#include "bn_span.h"
+#include "bn_fixed.h"
+#include "bn_display.h"
+
+namespace bn
+{
+
+// sine_wave
+
+/**
+ * @brief Generates H-Blank effect values following a sine wave.
+ *
+ * Values are regenerated only when the parameters change,
+ * using forward differencing instead of calculating a sine per screen line.
+ *
+ * It doesn't copy the values to the H-Blank effect, so it must outlive the H-Blank effects that reference them.
+ *
+ * @ingroup hblank_effect
+ */
+class sine_wave_hbe_values
+{
+
+public:
+    /**
+     * @brief Constructor.
+     * @param amplitude Maximum absolute value of the wave.
+     * @param degrees_step Angle in degrees advanced between consecutive screen lines.
+     * @param degrees_phase Angle in degrees of the first screen line.
+     */
+    sine_wave_hbe_values(fixed amplitude, fixed degrees_step, fixed degrees_phase = 0);
+
+    /**
+     * @brief Returns the maximum absolute value of the wave.
+     */
+    [[nodiscard]] fixed amplitude() const
+    {
+        return _amplitude;
+    }
+
+    /**
+     * @brief Sets the maximum absolute value of the wave.
+     */
+    void set_amplitude(fixed amplitude);
+
+    /**
+     * @brief Returns the angle in degrees advanced between consecutive screen lines.
+     */
+    [[nodiscard]] fixed degrees_step() const
+    {
+        return _degrees_step;
+    }
+
+    /**
+     * @brief Sets the angle in degrees advanced between consecutive screen lines.
+     */
+    void set_degrees_step(fixed degrees_step);
+
+    /**
+     * @brief Returns the angle in degrees of the first screen line.
+     */
+    [[nodiscard]] fixed degrees_phase() const
+    {
+        return _degrees_phase;
+    }
+
+    /**
+     * @brief Sets the angle in degrees of the first screen line.
+     *
+     * Increasing it each frame scrolls the wave.
+     */
+    void set_degrees_phase(fixed degrees_phase);
+
+    /**
+     * @brief Returns the generated values, one per screen line.
+     */
+    [[nodiscard]] span<const fixed> values() const
+    {
+        return _values;
+    }
+
+    /**
+     * @brief Regenerates the values if the parameters have changed
+     * and reloads them in the given H-Blank effect.
+     * @param hbe H-Blank effect which references the values of this generator.
+     */
+    template<class HbePtr>
+    void update(HbePtr& hbe)
+    {
+        if(_regenerate)
+        {
+            _generate();
+            hbe.reload_values_ref();
+        }
+    }
+
+private:
+    fixed _values[display::height()];
+    fixed _amplitude;
+    fixed _degrees_step;
+    fixed _degrees_phase;
+    bool _regenerate = false;
+
+    void _generate();
+};
+
+
+// linear_gradient
+
+/**
+ * @brief Generates H-Blank effect values which are linearly interpolated from the first screen line
+ * to the last one.
+ *
+ * Values are regenerated only when the parameters change, using forward differencing.
+ *
+ * It doesn't copy the values to the H-Blank effect, so it must outlive the H-Blank effects that reference them.
+ *
+ * @ingroup hblank_effect
+ */
+class linear_gradient_hbe_values
+{
+
+public:
+    /**
+     * @brief Constructor.
+     * @param first_value Value of the first screen line.
+     * @param last_value Value of the last screen line.
+     */
+    linear_gradient_hbe_values(fixed first_value, fixed last_value);
+
+    /**
+     * @brief Returns the value of the first screen line.
+     */
+    [[nodiscard]] fixed first_value() const
+    {
+        return _first_value;
+    }
+
+    /**
+     * @brief Sets the value of the first screen line.
+     */
+    void set_first_value(fixed first_value);
+
+    /**
+     * @brief Returns the value of the last screen line.
+     */
+    [[nodiscard]] fixed last_value() const
+    {
+        return _last_value;
+    }
+
+    /**
+     * @brief Sets the value of the last screen line.
+     */
+    void set_last_value(fixed last_value);
+
+    /**
+     * @brief Returns the generated values, one per screen line.
+     */
+    [[nodiscard]] span<const fixed> values() const
+    {
+        return _values;
+    }
+
+    /**
+     * @brief Regenerates the values if the parameters have changed
+     * and reloads them in the given H-Blank effect.
+     * @param hbe H-Blank effect which references the values of this generator.
+     */
+    template<class HbePtr>
+    void update(HbePtr& hbe)
+    {
+        if(_regenerate)
+        {
+            _generate();
+            hbe.reload_values_ref();
+        }
+    }
+
+private:
+    fixed _values[display::height()];
+    fixed _first_value;
+    fixed _last_value;
+    bool _regenerate = false;
+
+    void _generate();
+};
+
+
+// perspective
+
+/**
+ * @brief Generates H-Blank effect values of a perspective row table.
+ *
+ * The value of each screen line below the horizon is scale / (line - horizon_line),
+ * and the value of the other lines is horizon_value.
+ *
+ * Values are fixed point numbers intended for position H-Blank effects (per line scrolling, depth fog, etc.).
+ * Affine register tables like the ones of the `mode_7` example are not generated:
+ * use bn::affine_bg_perspective_plane for that.
+ *
+ * Values are regenerated only when the parameters change, using a reciprocal LUT instead of divisions.
+ *
+ * It doesn't copy the values to the H-Blank effect, so it must outlive the H-Blank effects that reference them.
+ *
+ * @ingroup hblank_effect
+ */
+class perspective_hbe_values
+{
+
+public:
+    /**
+     * @brief Constructor.
+     * @param scale Value of the first screen line below the horizon.
+     * @param horizon_line Screen line of the horizon (it can be negative or beyond the last screen line).
+     * @param horizon_value Value of the screen lines above and at the horizon.
+     */
+    perspective_hbe_values(fixed scale, int horizon_line, fixed horizon_value = 0);
+
+    /**
+     * @brief Returns the value of the first screen line below the horizon.
+     */
+    [[nodiscard]] fixed scale() const
+    {
+        return _scale;
+    }
+
+    /**
+     * @brief Sets the value of the first screen line below the horizon.
+     */
+    void set_scale(fixed scale);
+
+    /**
+     * @brief Returns the screen line of the horizon.
+     */
+    [[nodiscard]] int horizon_line() const
+    {
+        return _horizon_line;
+    }
+
+    /**
+     * @brief Sets the screen line of the horizon (it can be negative or beyond the last screen line).
+     */
+    void set_horizon_line(int horizon_line);
+
+    /**
+     * @brief Returns the value of the screen lines above and at the horizon.
+     */
+    [[nodiscard]] fixed horizon_value() const
+    {
+        return _horizon_value;
+    }
+
+    /**
+     * @brief Sets the value of the screen lines above and at the horizon.
+     */
+    void set_horizon_value(fixed horizon_value);
+
+    /**
+     * @brief Returns the generated values, one per screen line.
+     */
+    [[nodiscard]] span<const fixed> values() const
+    {
+        return _values;
+    }
+
+    /**
+     * @brief Regenerates the values if the parameters have changed
+     * and reloads them in the given H-Blank effect.
+     * @param hbe H-Blank effect which references the values of this generator.
+     */
+    template<class HbePtr>
+    void update(HbePtr& hbe)
+    {
+        if(_regenerate)
+        {
+            _generate();
+            hbe.reload_values_ref();
+        }
+    }
+
+private:
+    fixed _values[display::height()];
+    fixed _scale;
+    fixed _horizon_value;
+    int _horizon_line;
+    bool _regenerate = false;
+
+    void _generate();
+};
+
+
+// keyframes
+
+/**
+ * @brief Value of a screen line used by bn::keyframes_hbe_values.
+ *
+ * @ingroup hblank_effect
+ */
+class hbe_keyframe
+{
+
+public:
+    /**
+     * @brief Constructor.
+     * @param line Screen line.
+     * @param value Value of the screen line.
+     */
+    constexpr hbe_keyframe(int line, fixed value) :
+        _line(line),
+        _value(value)
+    {
+        BN_ASSERT(line >= 0 && line < display::height(), "Invalid line: ", line);
+    }
+
+    /**
+     * @brief Returns the screen line.
+     */
+    [[nodiscard]] constexpr int line() const
+    {
+        return _line;
+    }
+
+    /**
+     * @brief Returns the value of the screen line.
+     */
+    [[nodiscard]] constexpr fixed value() const
+    {
+        return _value;
+    }
+
+private:
+    int _line;
+    fixed _value;
+};
+
+
+/**
+ * @brief Generates H-Blank effect values which are linearly interpolated between keyframes.
+ *
+ * Screen lines above the first keyframe take its value, and lines below the last keyframe take its value too.
+ *
+ * Values are regenerated only when the keyframes are reloaded, using forward differencing.
+ *
+ * The keyframes are not copied but referenced, so they should outlive this generator.
+ *
+ * It doesn't copy the values to the H-Blank effect, so it must outlive the H-Blank effects that reference them.
+ *
+ * @ingroup hblank_effect
+ */
+class keyframes_hbe_values
+{
+
+public:
+    /**
+     * @brief Constructor.
+     * @param keyframes_ref Reference to one or more keyframes sorted by screen line.
+     */
+    explicit keyframes_hbe_values(const span<const hbe_keyframe>& keyframes_ref);
+
+    /**
+     * @brief Returns the referenced keyframes.
+     */
+    [[nodiscard]] const span<const hbe_keyframe>& keyframes_ref() const
+    {
+        return _keyframes_ref;
+    }
+
+    /**
+     * @brief Sets the reference to the keyframes.
+     * @param keyframes_ref Reference to one or more keyframes sorted by screen line.
+     */
+    void set_keyframes_ref(const span<const hbe_keyframe>& keyframes_ref);
+
+    /**
+     * @brief Regenerates the values in the next update,
+     * since the referenced keyframes have been modified.
+     */
+    void reload_keyframes_ref()
+    {
+        _regenerate = true;
+    }
+
+    /**
+     * @brief Returns the generated values, one per screen line.
+     */
+    [[nodiscard]] span<const fixed> values() const
+    {
+        return _values;
+    }
+
+    /**
+     * @brief Regenerates the values if the keyframes have changed
+     * and reloads them in the given H-Blank effect.
+     * @param hbe H-Blank effect which references the values of this generator.
+     */
+    template<class HbePtr>
+    void update(HbePtr& hbe)
+    {
+        if(_regenerate)
+        {
+            _generate();
+            hbe.reload_values_ref();
+        }
+    }
+
+private:
+    fixed _values[display::height()];
+    span<const hbe_keyframe> _keyframes_ref;
+    bool _regenerate = false;
+
+    void _generate();
+};
+
+}
+
+#endif
@@ -36,6 +36,8 @@ namespace bn::hdma
      *
      * If the elements overlap, the behavior is undefined.
      *
+     * It can't be called while the low priority channel is reserved by a bn::hdma_stream.
+     *
      * @param source_ref Const reference to the memory location to copy from.
      * @param elements Number of elements to copy (not bytes).
      * @param destination_ref Reference to the memory location to copy to.
@@ -65,6 +67,8 @@ namespace bn::hdma
      *
      * High priority HDMA can cause issues with audio, so avoid it unless necessary.
      *
+     * It can't be called while the high priority channel is reserved by a bn::hdma_stream.
+     *
      * @param source_ref Const reference to the memory location to copy from.
      * @param elements Number of elements to copy (not bytes).
      * @param destination_ref Reference to the memory location to copy to.
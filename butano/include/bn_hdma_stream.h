@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_HDMA_STREAM_H
+#define BN_HDMA_STREAM_H
+
+/**
+ * @file
+ * bn::ihdma_stream and bn::hdma_stream implementation header file.
+ *
+ * @ingroup hdma
+ */
+
+#include "bn_span.h"
+#include "bn_display.h"
+
+namespace bn
+{
+
+/**
+ * @brief Base class of bn::hdma_stream.
+ *
+ * An HDMA stream reserves a DMA channel while it is alive and copies a table of values to a destination
+ * in each screen line. It owns a ring of tables, so the next frame's table can be written
+ * while the current one is being copied.
+ *
+ * A published table starts being copied in the next bn::core::update call,
+ * and it keeps being copied in skipped and missed frames until another one is published,
+ * so tables are never modified while they are being copied.
+ *
+ * Channels which don't interfere with audio are reserved first (see @ref BN_CFG_HDMA_MAX_CHANNELS),
+ * so bn::hdma and H-Blank effects can't use the channels reserved by HDMA streams.
+ *
+ * Can be used as a reference type for all bn::hdma_stream objects.
+ *
+ * @ingroup hdma
+ */
+class ihdma_stream
+{
+
+public:
+    ihdma_stream(const ihdma_stream& other) = delete;
+
+    ihdma_stream& operator=(const ihdma_stream& other) = delete;
+
+    /**
+     * @brief Destructor.
+     *
+     * It stops copying values and releases the reserved DMA channel immediately.
+     */
+    ~ihdma_stream();
+
+    /**
+     * @brief Returns the number of elements copied in each screen line.
+     */
+    [[nodiscard]] int elements() const
+    {
+        return _elements;
+    }
+
+    /**
+     * @brief Returns the number of tables of the ring.
+     */
+    [[nodiscard]] int tables_count() const
+    {
+        return _tables_count;
+    }
+
+    /**
+     * @brief Indicates if the reserved DMA channel is the high priority one,
+     * which can cause issues with audio.
+     */
+    [[nodiscard]] bool high_priority() const;
+
+    /**
+     * @brief Indicates if a table has been published and it hasn't been stopped.
+     */
+    [[nodiscard]] bool running() const
+    {
+        return _published_index >= 0;
+    }
+
+    /**
+     * @brief Publishes the table returned by the last next_table call,
+     * so it starts being copied in the next bn::core::update call.
+     */
+    void publish();
+
+    /**
+     * @brief Stops copying values in the next bn::core::update call.
+     */
+    void stop();
+
+protected:
+    /// @cond DO_NOT_DOCUMENT
+
+    ihdma_stream(void* tables_ptr, int elements, int tables_count, bool words, void* destination_ptr);
+
+    [[nodiscard]] int _next_table_index();
+
+    /// @endcond
+
+private:
+    uint8_t* _tables_ptr;
+    void* _destination_ptr;
+    int _elements;
+    int8_t _tables_count;
+    int8_t _channel_index;
+    int8_t _published_index = -1;
+    int8_t _write_index = -1;
+    bool _words;
+
+    [[nodiscard]] int _table_size() const
+    {
+        return display::height() * _elements * (_words ? 4 : 2);
+    }
+};
+
+
+/**
+ * @brief Copies a table of values to a destination in each screen line with HDMA,
+ * using a ring of tables to avoid tearing.
+ *
+ * @tparam Type Type of the values to copy (2 or 4 bytes, so they are copied in 16 or 32 bit units).
+ * @tparam Elements Number of elements copied in each screen line.
+ * @tparam TablesCount Number of tables of the ring (2 to write one table while the other one is being copied,
+ * 3 or more to publish more than one table per bn::core::update call without blocking).
+ *
+ * @ingroup hdma
+ */
+template<typename Type, int Elements, int TablesCount = 2>
+class hdma_stream : public ihdma_stream
+{
+    static_assert(sizeof(Type) == 2 || sizeof(Type) == 4);
+    static_assert(Elements > 0);
+    static_assert(TablesCount >= 2 && TablesCount <= 8);
+
+public:
+    /**
+     * @brief Constructor.
+     *
+     * It reserves a DMA channel until it is destroyed.
+     *
+     * @param destination_ref Reference to the memory location to copy values to in each screen line.
+     */
+    explicit hdma_stream(Type& destination_ref) :
+        ihdma_stream(_tables, Elements, TablesCount, sizeof(Type) == 4, &destination_ref)
+    {
+    }
+
+    /**
+     * @brief Returns the table to write before calling publish.
+     *
+     * It is not the table being copied in this frame, and its previous contents are from an older frame.
+     *
+     * Its values are indexed by screen line: the first Elements values are copied to the first screen line,
+     * the next Elements values are copied to the second screen line, etc.
+     */
+    [[nodiscard]] span<Type> next_table()
+    {
+        return span<Type>(_tables[_next_table_index()], table_size);
+    }
+
+private:
+    static constexpr int table_size = display::height() * Elements;
+
+    alignas(int) Type _tables[TablesCount][table_size];
+};
+
+}
+
+#endif
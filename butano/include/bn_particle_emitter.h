@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_PARTICLE_EMITTER_H
+#define BN_PARTICLE_EMITTER_H
+
+/**
+ * @file
+ * bn::particle_emitter header file.
+ *
+ * @ingroup sprite
+ */
+
+#include "bn_limits.h"
+#include "bn_fixed_point.h"
+
+namespace bn
+{
+
+/**
+ * @brief Generates particles for a bn::iparticle_system at a constant rate.
+ *
+ * @ingroup sprite
+ */
+class particle_emitter
+{
+
+public:
+    /**
+     * @brief Constructor.
+     * @param position Position of the generated particles (relative to the center of the screen).
+     * @param velocity Initial velocity of the generated particles.
+     * @param velocity_spread Maximum random deviation added to the initial velocity of the generated particles.
+     * @param rate Number of particles generated per update (it can be a fractional number).
+     * @param lifetime Number of updates that each generated particle is alive.
+     */
+    constexpr particle_emitter(const fixed_point& position, const fixed_point& velocity,
+                               const fixed_point& velocity_spread, fixed rate, int lifetime) :
+        _position(position),
+        _velocity(velocity),
+        _velocity_spread(velocity_spread),
+        _rate(rate),
+        _lifetime(lifetime)
+    {
+        BN_ASSERT(rate >= 0, "Invalid rate: ", rate);
+        BN_ASSERT(lifetime > 0 && lifetime <= numeric_limits<int16_t>::max(), "Invalid lifetime: ", lifetime);
+    }
+
+    /**
+     * @brief Returns the position of the generated particles (relative to the center of the screen).
+     */
+    [[nodiscard]] constexpr const fixed_point& position() const
+    {
+        return _position;
+    }
+
+    /**
+     * @brief Sets the position of the generated particles (relative to the center of the screen).
+     */
+    constexpr void set_position(const fixed_point& position)
+    {
+        _position = position;
+    }
+
+    /**
+     * @brief Returns the initial velocity of the generated particles.
+     */
+    [[nodiscard]] constexpr const fixed_point& velocity() const
+    {
+        return _velocity;
+    }
+
+    /**
+     * @brief Sets the initial velocity of the generated particles.
+     */
+    constexpr void set_velocity(const fixed_point& velocity)
+    {
+        _velocity = velocity;
+    }
+
+    /**
+     * @brief Returns the maximum random deviation added to the initial velocity of the generated particles.
+     */
+    [[nodiscard]] constexpr const fixed_point& velocity_spread() const
+    {
+        return _velocity_spread;
+    }
+
+    /**
+     * @brief Sets the maximum random deviation added to the initial velocity of the generated particles.
+     */
+    constexpr void set_velocity_spread(const fixed_point& velocity_spread)
+    {
+        _velocity_spread = velocity_spread;
+    }
+
+    /**
+     * @brief Returns the number of particles generated per update.
+     */
+    [[nodiscard]] constexpr fixed rate() const
+    {
+        return _rate;
+    }
+
+    /**
+     * @brief Sets the number of particles generated per update (it can be a fractional number).
+     */
+    constexpr void set_rate(fixed rate)
+    {
+        BN_ASSERT(rate >= 0, "Invalid rate: ", rate);
+
+        _rate = rate;
+    }
+
+    /**
+     * @brief Returns the number of updates that each generated particle is alive.
+     */
+    [[nodiscard]] constexpr int lifetime() const
+    {
+        return _lifetime;
+    }
+
+    /**
+     * @brief Sets the number of updates that each generated particle is alive.
+     */
+    constexpr void set_lifetime(int lifetime)
+    {
+        BN_ASSERT(lifetime > 0 && lifetime <= numeric_limits<int16_t>::max(), "Invalid lifetime: ", lifetime);
+
+        _lifetime = lifetime;
+    }
+
+    /**
+     * @brief Advances the emitter one update.
+     * @return Number of particles to generate in this update.
+     */
+    [[nodiscard]] constexpr int update()
+    {
+        fixed pending_particles = _pending_particles + _rate;
+        int result = pending_particles.right_shift_integer();
+        _pending_particles = pending_particles - result;
+        return result;
+    }
+
+private:
+    fixed_point _position;
+    fixed_point _velocity;
+    fixed_point _velocity_spread;
+    fixed _rate;
+    fixed _pending_particles;
+    int _lifetime;
+};
+
+}
+
+#endif
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_PARTICLE_SYSTEM_H
+#define BN_PARTICLE_SYSTEM_H
+
+/**
+ * @file
+ * bn::iparticle_system and bn::particle_system implementation header file.
+ *
+ * @ingroup sprite
+ */
+
+#include "bn_random.h"
+#include "bn_fixed_point.h"
+#include "bn_sprite_tiles_ptr.h"
+#include "bn_sprite_shape_size.h"
+#include "bn_sprite_palette_ptr.h"
+#include "../hw/include/bn_hw_sprites_constants.h"
+
+namespace bn
+{
+
+class sprite_item;
+class particle_emitter;
+
+/**
+ * @brief Base class of bn::particle_system.
+ *
+ * Particles are not sprites created with sprite_ptr static constructors:
+ * they are simulated in IWRAM and written directly to a block of hardware sprite handles
+ * reserved with bn::sprites::set_reserved_handles_count, so they don't use sprite items nor sort layers.
+ *
+ * Since reserved handles are the first ones of OAM, particles are drawn above other sprites
+ * with the same background priority.
+ *
+ * Particle systems must be destroyed in reverse creation order.
+ *
+ * Can be used as a reference type for all bn::particle_system objects.
+ *
+ * @ingroup sprite
+ */
+class iparticle_system
+{
+
+public:
+    iparticle_system(const iparticle_system& other) = delete;
+
+    iparticle_system& operator=(const iparticle_system& other) = delete;
+
+    /**
+     * @brief Destructor.
+     *
+     * It releases the reserved hardware sprite handles.
+     */
+    ~iparticle_system();
+
+    /**
+     * @brief Returns the sprite tiles used by all particles (all tile sets of the sprite_item).
+     */
+    [[nodiscard]] const sprite_tiles_ptr& tiles() const
+    {
+        return _tiles;
+    }
+
+    /**
+     * @brief Returns the sprite palette used by all particles.
+     */
+    [[nodiscard]] const sprite_palette_ptr& palette() const
+    {
+        return _palette;
+    }
+
+    /**
+     * @brief Returns the shape and size of all particles.
+     */
+    [[nodiscard]] const sprite_shape_size& shape_size() const
+    {
+        return _shape_size;
+    }
+
+    /**
+     * @brief Returns the index of the first hardware sprite handle used by this particle system.
+     */
+    [[nodiscard]] int first_hw_id() const
+    {
+        return _first_hw_id;
+    }
+
+    /**
+     * @brief Returns the number of alive particles.
+     */
+    [[nodiscard]] int size() const
+    {
+        return _size;
+    }
+
+    /**
+     * @brief Returns the maximum number of alive particles.
+     */
+    [[nodiscard]] int max_size() const
+    {
+        return _max_size;
+    }
+
+    /**
+     * @brief Indicates if there's no alive particles.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        return _size == 0;
+    }
+
+    /**
+     * @brief Indicates if no more particles can be emitted.
+     */
+    [[nodiscard]] bool full() const
+    {
+        return _size == _max_size;
+    }
+
+    /**
+     * @brief Returns the velocity increment applied to all particles in each update.
+     */
+    [[nodiscard]] const fixed_point& gravity() const
+    {
+        return _gravity;
+    }
+
+    /**
+     * @brief Sets the velocity increment applied to all particles in each update.
+     */
+    void set_gravity(const fixed_point& gravity)
+    {
+        _gravity = gravity;
+    }
+
+    /**
+     * @brief Returns the priority of the particles relative to backgrounds.
+     */
+    [[nodiscard]] int bg_priority() const
+    {
+        return _bg_priority;
+    }
+
+    /**
+     * @brief Sets the priority of the particles relative to backgrounds.
+     *
+     * Particles with higher priority are drawn first (and therefore can be covered by later sprites and backgrounds).
+     *
+     * @param bg_priority Priority relative to backgrounds in the range [0..3].
+     */
+    void set_bg_priority(int bg_priority);
+
+    /**
+     * @brief Returns the number of updates to wait before changing the tile set of each particle.
+     */
+    [[nodiscard]] int wait_updates() const
+    {
+        return _wait_updates;
+    }
+
+    /**
+     * @brief Sets the number of updates to wait before changing the tile set of each particle.
+     *
+     * Particles loop over all tile sets of the sprite_item.
+     *
+     * @param wait_updates Number of updates to wait in the range [0..255].
+     */
+    void set_wait_updates(int wait_updates);
+
+    /**
+     * @brief Emits a new particle.
+     * @param position Position of the new particle (relative to the center of the screen).
+     * @param velocity Initial velocity of the new particle.
+     * @param lifetime Number of updates that the new particle is alive.
+     * @return `true` if the particle was emitted, `false` if the particle system is full.
+     */
+    bool emit(const fixed_point& position, const fixed_point& velocity, int lifetime);
+
+    /**
+     * @brief Advances the given particle_emitter one update and emits the particles it generates.
+     * @return Number of emitted particles.
+     */
+    int emit(particle_emitter& emitter);
+
+    /**
+     * @brief Removes all alive particles.
+     */
+    void clear()
+    {
+        _size = 0;
+    }
+
+    /**
+     * @brief Moves and animates all alive particles, removing the ones which lifetime has expired.
+     *
+     * It should be called once per frame.
+     */
+    void update();
+
+protected:
+    /// @cond DO_NOT_DOCUMENT
+
+    class particle
+    {
+
+    public:
+        fixed_point position;
+        fixed_point velocity;
+        int16_t life;
+        uint8_t graphics_index;
+        uint8_t wait_updates;
+    };
+
+    iparticle_system(const sprite_item& item, particle* particles_ptr, int max_size);
+
+    /// @endcond
+
+private:
+    sprite_tiles_ptr _tiles;
+    sprite_palette_ptr _palette;
+    sprite_shape_size _shape_size;
+    fixed_point _gravity;
+    random _random;
+    particle* _particles_ptr;
+    int _max_size;
+    int _size = 0;
+    int _last_size = 0;
+    int _first_hw_id;
+    int _graphics_count;
+    int _tiles_count_per_graphic;
+    int _bg_priority = 3;
+    int _wait_updates = 0;
+
+    [[nodiscard]] BN_CODE_IWRAM int _update_particles(void* hw_handles, int attr0, int attr1, int attr2);
+};
+
+
+/**
+ * @brief Lightweight particle system which writes its particles directly to reserved hardware sprite handles.
+ *
+ * @tparam MaxSize Maximum number of alive particles (and number of reserved hardware sprite handles).
+ *
+ * @ingroup sprite
+ */
+template<int MaxSize>
+class particle_system : public iparticle_system
+{
+    static_assert(MaxSize > 0 && MaxSize < hw::sprites::count());
+
+public:
+    /**
+     * @brief Constructor.
+     * @param item sprite_item used by all particles. Particles loop over all of its tile sets.
+     */
+    explicit particle_system(const sprite_item& item) :
+        iparticle_system(item, _particles_array, MaxSize)
+    {
+    }
+
+private:
+    particle _particles_array[MaxSize];
+};
+
+}
+
+#endif
@@ -21,6 +21,9 @@
  *
  * Defines the start of a code block in which elapsed time is going to be measured.
  *
+ * Code blocks can be nested: the elapsed time of a code block is also attributed to its parent,
+ * and it is discounted from the self time of the parent.
+ *
  * @param id Small text string which identifies the code block.
  *
  * @ingroup profiler
@@ -29,7 +32,7 @@
 /**
  * @def BN_PROFILER_STOP
  *
- * Defines the end of a code block in which elapsed time is going to be measured.
+ * Defines the end of the last started code block in which elapsed time is going to be measured.
  *
  * @ingroup profiler
  */
@@ -56,6 +59,14 @@
          * @brief Stops the execution and shows the profiling results on the screen.
          */
         [[noreturn]] void show();
+
+        /**
+         * @brief Prints the profiling results with BN_LOG.
+         *
+         * For each code block it prints its parent, total ticks, self ticks (total ticks minus ticks spent in
+         * nested code blocks), max ticks, profiled frames and 50th, 95th and 99th percentile ticks per frame.
+         */
+        void log();
     }
 
     /// @cond DO_NOT_DOCUMENT
@@ -65,7 +76,13 @@
         struct ticks
         {
             int64_t total = 0;
+            int64_t self_total = 0;
+            const char* parent_id = nullptr;
             int max = 0;
+            int frame_max = 0;
+            int frames = 0;
+            int current_frame = 0;
+            int histogram[BN_CFG_PROFILER_HISTOGRAM_SIZE] = {};
         };
 
         using ticks_map = bn::unordered_map<const char*, ticks, BN_CFG_PROFILER_MAX_ENTRIES * 2>;
@@ -74,8 +91,14 @@
 
         void stop();
 
+        void update_frame();
+
         [[nodiscard]] const ticks_map& ticks_per_entry();
 
+        [[nodiscard]] int histogram_bucket_ticks();
+
+        [[nodiscard]] int percentile_ticks(const ticks& entry_ticks, int percentile);
+
         void reset();
     }
 
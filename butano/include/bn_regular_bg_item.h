@@ -110,8 +110,7 @@ public:
     /**
      * @brief Indicates if backgrounds generated with this item are big or not.
      *
-     * Big backgrounds are slower CPU wise and don't support wrapping
-     * (they can't be moved beyond their boundaries), but can have any width or height multiple of 256 pixels.
+     * Big backgrounds are slower CPU wise, but can have any width or height multiple of 256 pixels.
      */
     [[nodiscard]] constexpr bool big() const
     {
@@ -177,6 +176,23 @@ public:
      */
     [[nodiscard]] optional<regular_bg_ptr> create_bg_optional(const fixed_point& position) const;
 
+    /**
+     * @brief Creates a regular_bg_ptr using the information contained in this item,
+     * streaming its tiles on demand (see regular_bg_map_ptr::create_streamed).
+     * @param x Horizontal position of the regular background.
+     * @param y Vertical position of the regular background.
+     * @return The requested regular_bg_ptr.
+     */
+    [[nodiscard]] regular_bg_ptr create_streamed_bg(fixed x, fixed y) const;
+
+    /**
+     * @brief Creates a regular_bg_ptr using the information contained in this item,
+     * streaming its tiles on demand (see regular_bg_map_ptr::create_streamed).
+     * @param position Position of the regular background.
+     * @return The requested regular_bg_ptr.
+     */
+    [[nodiscard]] regular_bg_ptr create_streamed_bg(const fixed_point& position) const;
+
     /**
      * @brief Searches for a regular_bg_map_ptr which references the information provided by this item.
      * @return regular_bg_map_ptr which references the information provided by this item if it has been found;
@@ -238,6 +254,17 @@ public:
      */
     [[nodiscard]] optional<regular_bg_map_ptr> create_new_map_optional() const;
 
+    /**
+     * @brief Creates a regular_bg_map_ptr which references the information provided by this item,
+     * streaming its tiles on demand (see regular_bg_map_ptr::create_streamed).
+     *
+     * The map cells are not copied but referenced,
+     * so they should outlive the regular_bg_map_ptr to avoid dangling references.
+     *
+     * @return regular_bg_map_ptr which references the information provided by this item.
+     */
+    [[nodiscard]] regular_bg_map_ptr create_streamed_map() const;
+
     /**
      * @brief Default equal operator.
      */
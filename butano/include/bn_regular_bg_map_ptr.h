@@ -127,6 +127,82 @@ public:
      */
     [[nodiscard]] static regular_bg_map_ptr create_new(const regular_bg_item& item);
 
+    /**
+     * @brief Creates a regular_bg_map_ptr which references the given map cells and streams their tiles on demand.
+     *
+     * Only the tiles referenced by the map cells stored in VRAM are uploaded to a cache of
+     * @ref BN_CFG_BG_BLOCKS_STREAMED_TILES_COUNT VRAM tiles, so the map can reference more tiles than the cache holds.
+     *
+     * The cache must be big enough to store the tiles referenced by 32x32 map cells.
+     *
+     * Up to @ref BN_CFG_BG_BLOCKS_STREAMED_TILES_MAX_UPLOADS tiles are uploaded per frame,
+     * so map cells whose tiles exceed this budget are committed in the next frames.
+     *
+     * Only big maps can stream their tiles, and only one map can stream its tiles at the same time.
+     *
+     * The map cells are not copied but referenced,
+     * so they should outlive the regular_bg_map_ptr to avoid dangling references.
+     *
+     * @param map_item regular_bg_map_item which references the map cells to handle.
+     * @param tiles_item Uncompressed tiles referenced by the map cells to handle.
+     * @param palette Referenced color palette of the map to handle.
+     * @return regular_bg_map_ptr which references the given information.
+     */
+    [[nodiscard]] static regular_bg_map_ptr create_streamed(
+            const regular_bg_map_item& map_item, const regular_bg_tiles_item& tiles_item, bg_palette_ptr palette);
+
+    /**
+     * @brief Creates a regular_bg_map_ptr which references the given map cells and streams their tiles on demand.
+     *
+     * Only the tiles referenced by the map cells stored in VRAM are uploaded to a cache of
+     * @ref BN_CFG_BG_BLOCKS_STREAMED_TILES_COUNT VRAM tiles, so the map can reference more tiles than the cache holds.
+     *
+     * Tile indexes are read from the given span instead of from the map cells,
+     * so the map can reference up to 65535 different tiles instead of 1024.
+     *
+     * The cache must be big enough to store the tiles referenced by 32x32 map cells.
+     *
+     * Up to @ref BN_CFG_BG_BLOCKS_STREAMED_TILES_MAX_UPLOADS tiles are uploaded per frame,
+     * so map cells whose tiles exceed this budget are committed in the next frames.
+     *
+     * Only big uncompressed maps can stream their tiles with this method,
+     * and only one map can stream its tiles at the same time.
+     *
+     * The map cells and the tile indexes are not copied but referenced,
+     * so they should outlive the regular_bg_map_ptr to avoid dangling references.
+     *
+     * @param map_item regular_bg_map_item which references the map cells to handle.
+     * Their tile indexes are ignored, but their flip and palette bits are not.
+     * @param tile_indexes Index in tiles_item of the tile referenced by each map cell.
+     * @param tiles_item Uncompressed tiles referenced by the map cells to handle.
+     * @param palette Referenced color palette of the map to handle.
+     * @return regular_bg_map_ptr which references the given information.
+     */
+    [[nodiscard]] static regular_bg_map_ptr create_streamed(
+            const regular_bg_map_item& map_item, const span<const uint16_t>& tile_indexes,
+            const regular_bg_tiles_item& tiles_item, bg_palette_ptr palette);
+
+    /**
+     * @brief Creates a regular_bg_map_ptr which references the given map cells and streams their tiles on demand.
+     *
+     * Only the tiles referenced by the map cells stored in VRAM are uploaded to a cache of
+     * @ref BN_CFG_BG_BLOCKS_STREAMED_TILES_COUNT VRAM tiles, so the map can reference more tiles than the cache holds.
+     *
+     * The cache must be big enough to store the tiles referenced by 32x32 map cells.
+     *
+     * Up to @ref BN_CFG_BG_BLOCKS_STREAMED_TILES_MAX_UPLOADS tiles are uploaded per frame,
+     * so map cells whose tiles exceed this budget are committed in the next frames.
+     *
+     * Only big maps can stream their tiles, and only one map can stream its tiles at the same time.
+     *
+     * The map cells are not copied but referenced,
+     * so they should outlive the regular_bg_map_ptr to avoid dangling references.
+     *
+     * @param item regular_bg_item which references the tiles, the color palette and the map cells to handle.
+     * @return regular_bg_map_ptr which references the given information.
+     */
+    [[nodiscard]] static regular_bg_map_ptr create_streamed(const regular_bg_item& item);
+
     /**
      * @brief Creates a regular_bg_map_ptr which references a chunk of VRAM map cells not visible on the screen.
      * @param dimensions Size in map cells of the map to allocate.
@@ -267,8 +343,7 @@ public:
     /**
      * @brief Indicates if this map is big or not.
      *
-     * Big backgrounds are slower CPU wise and don't support wrapping
-     * (they can't be moved beyond their boundaries), but can have any width or height multiple of 256 pixels.
+     * Big backgrounds are slower CPU wise, but can have any width or height multiple of 256 pixels.
      */
     [[nodiscard]] bool big() const;
 
@@ -191,8 +191,7 @@ public:
     /**
      * @brief Indicates if this regular background is big or not.
      *
-     * Big backgrounds are slower CPU wise and don't support wrapping
-     * (they can't be moved beyond their boundaries), but can have any width or height multiple of 256 pixels.
+     * Big backgrounds are slower CPU wise, but can have any width or height multiple of 256 pixels.
      */
     [[nodiscard]] bool big() const;
 
@@ -332,8 +331,6 @@ public:
 
     /**
      * @brief Sets the horizontal position of the regular background (relative to its camera, if it has one).
-     *
-     * Remember that big backgrounds don't support wrapping (they can't be moved beyond their boundaries).
      */
     void set_x(fixed x);
 
@@ -344,8 +341,6 @@ public:
 
     /**
      * @brief Sets the vertical position of the regular background (relative to its camera, if it has one).
-     *
-     * Remember that big backgrounds don't support wrapping (they can't be moved beyond their boundaries).
      */
     void set_y(fixed y);
 
@@ -357,8 +352,6 @@ public:
     /**
      * @brief Sets the position of the regular background (relative to its camera, if it has one).
      *
-     * Remember that big backgrounds don't support wrapping (they can't be moved beyond their boundaries).
-     *
      * @param x Horizontal position of the regular background (relative to its camera, if it has one).
      * @param y Vertical position of the regular background (relative to its camera, if it has one).
      */
@@ -366,8 +359,6 @@ public:
 
     /**
      * @brief Sets the position of the regular background (relative to its camera, if it has one).
-     *
-     * Remember that big backgrounds don't support wrapping (they can't be moved beyond their boundaries).
      */
     void set_position(const fixed_point& position);
 
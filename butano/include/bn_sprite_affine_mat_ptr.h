@@ -63,6 +63,49 @@ public:
      */
     [[nodiscard]] static optional<sprite_affine_mat_ptr> create_optional(const affine_mat_attributes& attributes);
 
+    /**
+     * @brief Searches for an affine transformation matrix with the same GBA register values
+     * as the given affine_mat_attributes.
+     *
+     * Only matrices created with find_or_create and find_or_create_optional are searched,
+     * so private matrices (like the ones created by sprite_ptr setters) are never shared.
+     *
+     * @param attributes affine_mat_attributes to search.
+     * @return sprite_affine_mat_ptr with the same GBA register values as the given attributes if it has been found;
+     * bn::nullopt otherwise.
+     */
+    [[nodiscard]] static optional<sprite_affine_mat_ptr> find(const affine_mat_attributes& attributes);
+
+    /**
+     * @brief Searches for an affine transformation matrix with the same GBA register values
+     * as the given affine_mat_attributes. If it is not found, it creates a new one with them.
+     *
+     * Since the returned matrix can be shared with other sprites, it can't be modified.
+     *
+     * Sprites with similar transformations can share the same matrix
+     * if their attributes are quantized first (see affine_mat_attributes::quantized).
+     *
+     * @param attributes affine_mat_attributes of the output matrix.
+     * @return The requested sprite_affine_mat_ptr.
+     */
+    [[nodiscard]] static sprite_affine_mat_ptr find_or_create(const affine_mat_attributes& attributes);
+
+    /**
+     * @brief Searches for an affine transformation matrix with the same GBA register values
+     * as the given affine_mat_attributes. If it is not found, it creates a new one with them.
+     *
+     * Since the returned matrix can be shared with other sprites, it can't be modified.
+     *
+     * Sprites with similar transformations can share the same matrix
+     * if their attributes are quantized first (see affine_mat_attributes::quantized).
+     *
+     * @param attributes affine_mat_attributes of the output matrix.
+     * @return The requested sprite_affine_mat_ptr if it has been found or it could be allocated;
+     * bn::nullopt otherwise.
+     */
+    [[nodiscard]] static optional<sprite_affine_mat_ptr> find_or_create_optional(
+            const affine_mat_attributes& attributes);
+
     /**
      * @brief Copy constructor.
      * @param other sprite_affine_mat_ptr to copy.
@@ -111,6 +154,14 @@ public:
         return _id;
     }
 
+    /**
+     * @brief Indicates if this matrix has been created with find_or_create or find_or_create_optional,
+     * so it can be shared with other sprites and it can't be modified.
+     *
+     * sprite_ptr setters replace shared matrices with private copies before modifying them.
+     */
+    [[nodiscard]] bool shared() const;
+
     /**
      * @brief Returns the rotation angle in degrees.
      */
@@ -333,6 +333,32 @@ public:
      */
     sprite_builder& set_z_order(int z_order);
 
+    /**
+     * @brief Indicates if the sprites to generate are sorted by their vertical position or not.
+     *
+     * Y sorted sprites are drawn above the other y sorted sprites with the same background priority and z order
+     * which are placed above them on the screen.
+     */
+    [[nodiscard]] bool y_sorted() const
+    {
+        return _y_sorted;
+    }
+
+    /**
+     * @brief Sets if the sprites to generate must be sorted by their vertical position or not.
+     *
+     * Y sorted sprites are drawn above the other y sorted sprites with the same background priority and z order
+     * which are placed above them on the screen.
+     *
+     * @param y_sorted `true` if the sprites must be sorted by their vertical position; `false` otherwise.
+     * @return Reference to this.
+     */
+    sprite_builder& set_y_sorted(bool y_sorted)
+    {
+        _y_sorted = y_sorted;
+        return *this;
+    }
+
     /**
      * @brief Indicates if the sprites to generate are flipped in the horizontal axis or not.
      */
@@ -719,6 +745,7 @@ private:
     bool _window_enabled = false;
     bool _visible = true;
     bool _remove_affine_mat_when_not_needed = true;
+    bool _y_sorted = false;
 };
 
 }
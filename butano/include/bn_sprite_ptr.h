@@ -603,6 +603,28 @@ public:
      */
     void put_below();
 
+    /**
+     * @brief Indicates if this sprite is sorted by its vertical position or not.
+     *
+     * Y sorted sprites are drawn above the other y sorted sprites with the same background priority and z order
+     * which are placed above them on the screen.
+     */
+    [[nodiscard]] bool y_sorted() const;
+
+    /**
+     * @brief Sets if this sprite must be sorted by its vertical position or not.
+     *
+     * Y sorted sprites are drawn above the other y sorted sprites with the same background priority and z order
+     * which are placed above them on the screen.
+     *
+     * Sprites with the same background priority and z order are reordered each frame with an insertion sort,
+     * and sprites which are not y sorted keep their place in the drawing order,
+     * so for best results all of them should be y sorted.
+     *
+     * @param y_sorted `true` if this sprite must be sorted by its vertical position; `false` otherwise.
+     */
+    void set_y_sorted(bool y_sorted);
+
     /**
      * @brief Indicates if this sprite is flipped in the horizontal axis or not.
      */
@@ -13,8 +13,15 @@
  * @ingroup sprite
  */
 
+#include "bn_span_fwd.h"
 #include "../hw/include/bn_hw_sprites_constants.h"
 
+namespace bn
+{
+    class sprite_ptr;
+    class fixed_point;
+}
+
 /**
  * @brief Sprites related functions.
  *
@@ -70,6 +77,26 @@ namespace bn::sprites
         return 32767;
     }
 
+    /**
+     * @brief Sets the position of multiple sprites with a single call.
+     *
+     * It's faster than calling bn::sprite_ptr::set_position for each sprite.
+     *
+     * @param sprites Sprites to move.
+     * @param positions New position of each sprite (it must have the same size as sprites).
+     */
+    void set_positions(const span<sprite_ptr>& sprites, const span<const fixed_point>& positions);
+
+    /**
+     * @brief Adds the given deltas to the position of multiple sprites with a single call.
+     *
+     * It's faster than calling bn::sprite_ptr::set_position for each sprite.
+     *
+     * @param sprites Sprites to move.
+     * @param deltas Position delta of each sprite (it must have the same size as sprites).
+     */
+    void add_positions(const span<sprite_ptr>& sprites, const span<const fixed_point>& deltas);
+
     /**
      * @brief Returns the number of hardware sprite handles not used by Butano sprites manager.
      *
@@ -86,6 +113,15 @@ namespace bn::sprites
      */
     void set_reserved_handles_count(int reserved_handles_count);
 
+    /**
+     * @brief Returns the number of on screen sprites which were not shown in the last frame
+     * because there were no more available hardware sprite handles.
+     *
+     * Only sprites overflow modes different than BN_SPRITES_OVERFLOW_MODE_ASSERT can drop sprites
+     * (see BN_CFG_SPRITES_OVERFLOW_MODE).
+     */
+    [[nodiscard]] int dropped_items_count();
+
     /**
      * @brief Reloads the internal attributes of all sprites (including the reserved ones).
      *
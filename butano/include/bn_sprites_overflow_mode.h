@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BN_SPRITES_OVERFLOW_MODE_H
+#define BN_SPRITES_OVERFLOW_MODE_H
+
+/**
+ * @file
+ * Available sprites overflow modes header file.
+ *
+ * @ingroup sprite
+ */
+
+#include "bn_common.h"
+
+/**
+ * @def BN_SPRITES_OVERFLOW_MODE_ASSERT
+ *
+ * An assert is triggered when there are more on screen sprites than available hardware sprite handles.
+ *
+ * @ingroup sprite
+ */
+#define BN_SPRITES_OVERFLOW_MODE_ASSERT     0
+
+/**
+ * @def BN_SPRITES_OVERFLOW_MODE_FLICKER
+ *
+ * When there are more on screen sprites than available hardware sprite handles,
+ * the sort layers with the highest priority which fit in the available handles are always shown,
+ * and the remaining handles are assigned to the sprites of the other sort layers in a round-robin fashion,
+ * so a different subset of them is shown each frame.
+ *
+ * @ingroup sprite
+ */
+#define BN_SPRITES_OVERFLOW_MODE_FLICKER    1
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_affine_bg_perspective_plane.h"
+
+#include "bn_math.h"
+
+namespace bn
+{
+
+void affine_bg_perspective_plane::_generate_rows(int sin, int cos, row* rows) const
+{
+    // HDMA writes the first row in the second screen line, so the row of the first line is the last one:
+    constexpr int last_row = display::height() - 1;
+    constexpr int half_width = display::width() / 2;
+    constexpr int max_lambda = (1 << (15 + fixed::precision() - 8)) - 1; // pa and pc are 8.8 signed fixed point
+
+    int horizon_line = _horizon_line;
+    int first_line = min(max(horizon_line + 1, 0), display::height());
+    int camera_x = _camera_x.data();
+    int camera_height = _camera_height.data();
+    int camera_z = _camera_z.data();
+    int focal_length = _focal_length;
+
+    // Lines above the horizon point outside the background, so they are transparent if wrapping is disabled:
+    for(int line = 0; line < first_line; ++line)
+    {
+        row& line_row = rows[line ? line - 1 : last_row];
+        line_row.pa = 0;
+        line_row.pb = 0;
+        line_row.pc = 0;
+        line_row.pd = 0;
+        line_row.dx = -1;
+        line_row.dy = -1;
+    }
+
+    for(int line = first_line; line < display::height(); ++line)
+    {
+        int lambda = int((int64_t(camera_height) * lut_reciprocal(line - horizon_line).data()) >> 20);
+        lambda = min(lambda, max_lambda);
+        int lambda_cos = (lambda * cos) >> fixed::precision();
+        int lambda_sin = (lambda * sin) >> fixed::precision();
+
+        row& line_row = rows[line ? line - 1 : last_row];
+        line_row.pa = int16_t(lambda_cos >> 4);
+        line_row.pb = 0;
+        line_row.pc = int16_t(lambda_sin >> 4);
+        line_row.pd = 0;
+        line_row.dx = (camera_x - (half_width * lambda_cos) + (focal_length * lambda_sin)) >> 4;
+        line_row.dy = (camera_z - (half_width * lambda_sin) - (focal_length * lambda_cos)) >> 4;
+    }
+}
+
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_affine_bg_perspective_plane.h"
+
+#include "bn_math.h"
+#include "bn_hdma_manager.h"
+#include "../hw/include/bn_hw_bgs.h"
+
+namespace bn
+{
+
+affine_bg_perspective_plane::affine_bg_perspective_plane(affine_bg_ptr bg, int horizon_line, int focal_length) :
+    _bg(move(bg)),
+    _horizon_line(horizon_line),
+    _focal_length(focal_length),
+    _channel_index(int8_t(hdma_manager::stream_reserve()))
+{
+    BN_ASSERT(horizon_line >= display::height() - reciprocal_lut_size, "Invalid horizon line: ", horizon_line);
+    BN_ASSERT(focal_length > 0, "Invalid focal length: ", focal_length);
+}
+
+affine_bg_perspective_plane::~affine_bg_perspective_plane()
+{
+    hdma_manager::stream_release(_channel_index);
+}
+
+void affine_bg_perspective_plane::set_camera_x(fixed camera_x)
+{
+    if(camera_x != _camera_x)
+    {
+        _camera_x = camera_x;
+        _regenerate = true;
+    }
+}
+
+void affine_bg_perspective_plane::set_camera_height(fixed camera_height)
+{
+    if(camera_height != _camera_height)
+    {
+        _camera_height = camera_height;
+        _regenerate = true;
+    }
+}
+
+void affine_bg_perspective_plane::set_camera_z(fixed camera_z)
+{
+    if(camera_z != _camera_z)
+    {
+        _camera_z = camera_z;
+        _regenerate = true;
+    }
+}
+
+void affine_bg_perspective_plane::set_camera_position(fixed camera_x, fixed camera_height, fixed camera_z)
+{
+    set_camera_x(camera_x);
+    set_camera_height(camera_height);
+    set_camera_z(camera_z);
+}
+
+void affine_bg_perspective_plane::set_camera_yaw(fixed camera_yaw)
+{
+    BN_ASSERT(camera_yaw >= 0 && camera_yaw <= 360, "Camera yaw must be in the range [0, 360]: ", camera_yaw);
+
+    if(camera_yaw != _camera_yaw)
+    {
+        _camera_yaw = camera_yaw;
+        _regenerate = true;
+    }
+}
+
+void affine_bg_perspective_plane::set_horizon_line(int horizon_line)
+{
+    BN_ASSERT(horizon_line >= display::height() - reciprocal_lut_size, "Invalid horizon line: ", horizon_line);
+
+    if(horizon_line != _horizon_line)
+    {
+        _horizon_line = horizon_line;
+        _regenerate = true;
+    }
+}
+
+void affine_bg_perspective_plane::set_focal_length(int focal_length)
+{
+    BN_ASSERT(focal_length > 0, "Invalid focal length: ", focal_length);
+
+    if(focal_length != _focal_length)
+    {
+        _focal_length = focal_length;
+        _regenerate = true;
+    }
+}
+
+void affine_bg_perspective_plane::update()
+{
+    optional<int> hw_id = _bg.hw_id();
+
+    if(! hw_id)
+    {
+        if(_hw_id >= 0)
+        {
+            hdma_manager::stream_stop(_channel_index);
+            _hw_id = -1;
+        }
+
+        return;
+    }
+
+    int new_hw_id = *hw_id;
+
+    if(_regenerate || new_hw_id != _hw_id)
+    {
+        // The rows being written by HDMA in this frame are not modified:
+        int rows_index = _rows_index ^ 1;
+        row* rows = _rows[rows_index];
+        pair<fixed, fixed> sin_and_cos = degrees_lut_sin_and_cos(_camera_yaw);
+        _generate_rows(sin_and_cos.first.data(), sin_and_cos.second.data(), rows);
+
+        hdma_manager::stream_start(_channel_index, rows, sizeof(row) / 2, false,
+                                   hw::bgs::affine_mat_register(new_hw_id));
+        _hw_id = int8_t(new_hw_id);
+        _rows_index = int8_t(rows_index);
+        _regenerate = false;
+    }
+}
+
+}
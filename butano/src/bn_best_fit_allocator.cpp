@@ -33,6 +33,16 @@ namespace
 
         return bytes;
     }
+
+    [[nodiscard]] constexpr best_fit_allocator::size_type _bit_width(unsigned value)
+    {
+        return 32 - __builtin_clz(value);
+    }
+
+    [[nodiscard]] constexpr best_fit_allocator::size_type _trailing_zeros(unsigned value)
+    {
+        return __builtin_ctz(value);
+    }
 }
 
 best_fit_allocator::~best_fit_allocator() noexcept
@@ -63,6 +73,8 @@ void* best_fit_allocator::alloc(size_type bytes)
         return nullptr;
     }
 
+    _erase_free_item(item);
+
     size_type new_item_size = item->size - bytes;
 
     if(new_item_size > _sizeof_free_item)
@@ -73,7 +85,6 @@ void* best_fit_allocator::alloc(size_type bytes)
         new_item->previous = item;
         new_item->size = new_item_size;
         new_item->used = false;
-        new_item->free_items = item->free_items;
 
         item_type* new_next_item = new_item->next();
 
@@ -82,37 +93,7 @@ void* best_fit_allocator::alloc(size_type bytes)
             new_next_item->previous = new_item;
         }
 
-        if(item_type* previous_free_item = item->free_items.previous)
-        {
-            previous_free_item->free_items.next = new_item;
-        }
-        else
-        {
-            _first_free_item = new_item;
-        }
-
-        if(item_type* next_free_item = item->free_items.next)
-        {
-            next_free_item->free_items.previous = new_item;
-        }
-    }
-    else
-    {
-        item_type* next_free_item = item->free_items.next;
-
-        if(item_type* previous_free_item = item->free_items.previous)
-        {
-            previous_free_item->free_items.next = item->free_items.next;
-        }
-        else
-        {
-            _first_free_item = next_free_item;
-        }
-
-        if(next_free_item)
-        {
-            next_free_item->free_items.previous = item->free_items.previous;
-        }
+        _insert_free_item(new_item);
     }
 
     item->used = true;
@@ -190,19 +171,16 @@ void best_fit_allocator::free(void* ptr)
         _free_check(item);
     #endif
 
-    bool item_linked = false;
     item->used = false;
-    item->free_items.previous = nullptr;
-    item->free_items.next = nullptr;
     _free_bytes_count += item->size;
 
     if(item_type* previous_item = item->previous)
     {
         if(! previous_item->used)
         {
+            _erase_free_item(previous_item);
             previous_item->size += item->size;
             item = previous_item;
-            item_linked = true;
         }
     }
 
@@ -213,32 +191,7 @@ void best_fit_allocator::free(void* ptr)
     {
         if(! next_item->used)
         {
-            item_linked = true;
-
-            if(item_type* previous_free_item = next_item->free_items.previous)
-            {
-                if(previous_free_item == item)
-                {
-                    item->free_items.next = next_item->free_items.next;
-                }
-                else
-                {
-                    previous_free_item->free_items.next = item;
-                    item->free_items.previous = previous_free_item;
-                }
-            }
-
-            if(item_type* next_free_item = next_item->free_items.next)
-            {
-                next_free_item->free_items.previous = item;
-                item->free_items.next = next_free_item;
-            }
-
-            if(next_item == _first_free_item)
-            {
-                _first_free_item = nullptr;
-            }
-
+            _erase_free_item(next_item);
             item->size += next_item->size;
             next_item = item->next();
         }
@@ -249,45 +202,7 @@ void best_fit_allocator::free(void* ptr)
         }
     }
 
-    if(item_type* first_free_item = _first_free_item)
-    {
-        if(! item_linked)
-        {
-            item_type* free_item = first_free_item;
-            item_type* previous_free_item = nullptr;
-
-            while(free_item)
-            {
-                if(free_item < item)
-                {
-                    previous_free_item = free_item;
-                }
-                else
-                {
-                    free_item->free_items.previous = item;
-                    item->free_items.next = free_item;
-                    break;
-                }
-
-                free_item = free_item->free_items.next;
-            }
-
-            if(previous_free_item)
-            {
-                previous_free_item->free_items.next = item;
-                item->free_items.previous = previous_free_item;
-            }
-        }
-
-        if(first_free_item > item)
-        {
-            _first_free_item = item;
-        }
-    }
-    else
-    {
-        _first_free_item = item;
-    }
+    _insert_free_item(item);
 
     #if BN_CFG_BEST_FIT_ALLOCATOR_SANITY_CHECK_ENABLED
         _sanity_check();
@@ -299,6 +214,13 @@ void best_fit_allocator::reset(void* start, size_type bytes)
     BN_ASSERT(bytes >= 0 && bytes % size_type(sizeof(int)) == 0, "Invalid bytes: ", bytes);
     BN_ASSERT(empty(), "Allocator is not empty");
 
+    for(item_type*& free_items_bin : _free_items_bins)
+    {
+        free_items_bin = nullptr;
+    }
+
+    _free_items_bins_mask = 0;
+
     if(bytes >= _sizeof_free_item)
     {
         BN_ASSERT(start, "Start is null");
@@ -308,18 +230,15 @@ void best_fit_allocator::reset(void* start, size_type bytes)
         first_item->previous = nullptr;
         first_item->size = bytes;
         first_item->used = false;
-        first_item->free_items.previous = nullptr;
-        first_item->free_items.next = nullptr;
 
         _start_ptr = static_cast<uint8_t*>(start);
-        _first_free_item = first_item;
         _total_bytes_count = bytes;
         _free_bytes_count = bytes;
+        _insert_free_item(first_item);
     }
     else
     {
         _start_ptr = nullptr;
-        _first_free_item = nullptr;
         _total_bytes_count = 0;
         _free_bytes_count = 0;
     }
@@ -353,31 +272,113 @@ void best_fit_allocator::reset(void* start, size_type bytes)
     }
 #endif
 
-best_fit_allocator::item_type* best_fit_allocator::_best_free_item(size_type bytes)
+best_fit_allocator::size_type best_fit_allocator::_bin_index(size_type bytes)
+{
+    constexpr size_type exact_bins_limit = _sizeof_free_item + (_exact_bins_count * alignment_bytes);
+
+    if(bytes < exact_bins_limit)
+    {
+        return (bytes - _sizeof_free_item) / alignment_bytes;
+    }
+
+    size_type result = _exact_bins_count + _bit_width(unsigned(bytes)) - _bit_width(unsigned(exact_bins_limit));
+    return min(result, _bins_count - 1);
+}
+
+void best_fit_allocator::_insert_free_item(item_type* item)
 {
-    item_type* free_item = _first_free_item;
-    item_type* best_free_item = nullptr;
-    size_type best_free_item_bytes = numeric_limits<size_type>::max();
+    size_type bin_index = _bin_index(item->size);
+    item_type* next_free_item = _free_items_bins[bin_index];
+    item->free_items.previous = nullptr;
+    item->free_items.next = next_free_item;
 
-    while(free_item)
+    if(next_free_item)
     {
-        size_type free_item_bytes = free_item->size;
+        next_free_item->free_items.previous = item;
+    }
+
+    _free_items_bins[bin_index] = item;
+    _free_items_bins_mask |= 1u << unsigned(bin_index);
+}
 
-        if(free_item_bytes == bytes)
+void best_fit_allocator::_erase_free_item(item_type* item)
+{
+    item_type* next_free_item = item->free_items.next;
+
+    if(item_type* previous_free_item = item->free_items.previous)
+    {
+        previous_free_item->free_items.next = next_free_item;
+    }
+    else
+    {
+        size_type bin_index = _bin_index(item->size);
+        _free_items_bins[bin_index] = next_free_item;
+
+        if(! next_free_item)
+        {
+            _free_items_bins_mask &= ~(1u << unsigned(bin_index));
+        }
+    }
+
+    if(next_free_item)
+    {
+        next_free_item->free_items.previous = item->free_items.previous;
+    }
+}
+
+best_fit_allocator::item_type* best_fit_allocator::_best_free_item(size_type bytes)
+{
+    size_type bin_index = _bin_index(bytes);
+    item_type* free_item = _free_items_bins[bin_index];
+
+    if(bin_index < _exact_bins_count)
+    {
+        // Exact size fast path:
+        if(free_item)
         {
             return free_item;
         }
+    }
+    else
+    {
+        // Items of the same size class can be smaller than the requested size:
+        item_type* best_free_item = nullptr;
+        size_type best_free_item_bytes = numeric_limits<size_type>::max();
+
+        while(free_item)
+        {
+            size_type free_item_bytes = free_item->size;
+
+            if(free_item_bytes == bytes)
+            {
+                return free_item;
+            }
+
+            if(free_item_bytes > bytes && free_item_bytes < best_free_item_bytes)
+            {
+                best_free_item = free_item;
+                best_free_item_bytes = free_item_bytes;
+            }
+
+            free_item = free_item->free_items.next;
+        }
 
-        if(free_item_bytes > bytes && free_item_bytes < best_free_item_bytes)
+        if(best_free_item)
         {
-            best_free_item = free_item;
-            best_free_item_bytes = free_item_bytes;
+            return best_free_item;
         }
+    }
 
-        free_item = free_item->free_items.next;
+    // Any item of a bigger size class is big enough, so the first item of the smallest one is taken:
+    if(bin_index < _bins_count - 1)
+    {
+        if(unsigned bins_mask = _free_items_bins_mask >> unsigned(bin_index + 1))
+        {
+            return _free_items_bins[bin_index + 1 + _trailing_zeros(bins_mask)];
+        }
     }
 
-    return best_free_item;
+    return nullptr;
 }
 
 #if BN_CFG_BEST_FIT_ALLOCATOR_SANITY_CHECK_ENABLED
@@ -385,7 +386,6 @@ best_fit_allocator::item_type* best_fit_allocator::_best_free_item(size_type byt
     {
         const item_type* item = _begin_item();
         const item_type* end_item = _end_item();
-        const item_type* first_free_item = nullptr;
         size_type real_used_bytes = 0;
         size_type num_free_items = 0;
 
@@ -415,32 +415,33 @@ best_fit_allocator::item_type* best_fit_allocator::_best_free_item(size_type byt
             else
             {
                 ++num_free_items;
-
-                if(! first_free_item)
-                {
-                    first_free_item = item;
-                }
             }
 
             item = next_item;
         }
 
-        BN_ASSERT(first_free_item == _first_free_item);
         BN_ASSERT(real_used_bytes == used_bytes(), real_used_bytes, " - ", used_bytes());
 
-        item_type* free_item = _first_free_item;
         size_type num_list_free_items = 0;
 
-        while(free_item)
+        for(size_type bin_index = 0; bin_index < _bins_count; ++bin_index)
         {
-            ++num_list_free_items;
+            item_type* free_item = _free_items_bins[bin_index];
+            BN_ASSERT(bool(free_item) == bool(_free_items_bins_mask & (1u << unsigned(bin_index))), bin_index);
+            BN_ASSERT(! free_item || ! free_item->free_items.previous, bin_index);
 
-            BN_ASSERT(! free_item->used);
+            while(free_item)
+            {
+                ++num_list_free_items;
+
+                BN_ASSERT(! free_item->used);
+                BN_ASSERT(_bin_index(free_item->size) == bin_index, free_item->size, " - ", bin_index);
 
-            item_type* next_free_item = free_item->free_items.next;
-            BN_ASSERT(! next_free_item || next_free_item->free_items.previous == free_item);
+                item_type* next_free_item = free_item->free_items.next;
+                BN_ASSERT(! next_free_item || next_free_item->free_items.previous == free_item);
 
-            free_item = next_free_item;
+                free_item = next_free_item;
+            }
         }
 
         BN_ASSERT(num_free_items == num_list_free_items);
@@ -6,10 +6,12 @@
 #include "bn_bg_blocks_manager.h"
 
 #include "bn_limits.h"
+#include "bn_memory.h"
 #include "bn_string_view.h"
 #include "bn_bgs_manager.h"
 #include "bn_unordered_map.h"
 #include "bn_config_bg_blocks.h"
+#include "../hw/include/bn_hw_dma.h"
 #include "../hw/include/bn_hw_memory.h"
 #include "../hw/include/bn_hw_bg_blocks.h"
 
@@ -39,6 +41,11 @@ namespace
 {
     static_assert(BN_CFG_BG_BLOCKS_MAX_ITEMS > 0 && BN_CFG_BG_BLOCKS_MAX_ITEMS <= hw::bg_tiles::blocks_count());
     static_assert(power_of_two(BN_CFG_BG_BLOCKS_MAX_ITEMS));
+    static_assert(BN_CFG_BG_BLOCKS_REGULAR_BIG_MAP_CHUNKS_CACHE_SIZE == 0 ||
+                  BN_CFG_BG_BLOCKS_REGULAR_BIG_MAP_CHUNKS_CACHE_SIZE >= 2);
+    static_assert(BN_CFG_BG_BLOCKS_AFFINE_BIG_MAP_CHUNKS_CACHE_SIZE == 0 ||
+                  BN_CFG_BG_BLOCKS_AFFINE_BIG_MAP_CHUNKS_CACHE_SIZE >= 2);
+    static_assert(BN_CFG_BG_BLOCKS_STREAMED_TILES_COUNT >= 0 && BN_CFG_BG_BLOCKS_STREAMED_TILES_COUNT <= 1024);
 
 
     #if BN_CFG_LOG_ENABLED
@@ -150,12 +157,13 @@ namespace
 
     private:
         unsigned _status: 2 = unsigned(status_type::FREE);
-        unsigned _compression: 2 = unsigned(compression_type::NONE);
+        unsigned _compression: 3 = unsigned(compression_type::NONE);
 
     public:
         bool is_tiles: 1 = false;
         bool is_affine: 1 = false;
         bool commit: 1 = false;
+        bool streamed_tiles: 1 = false;
 
         [[nodiscard]] status_type status() const
         {
@@ -351,6 +359,226 @@ namespace
     };
 
 
+    template<typename Cell>
+    class big_map_chunk_type
+    {
+
+    public:
+        alignas(int) Cell cells[32 * 32];
+        const uint8_t* data = nullptr;
+        unsigned last_usage = 0;
+    };
+
+
+    constexpr int regular_big_map_chunks_count = BN_CFG_BG_BLOCKS_REGULAR_BIG_MAP_CHUNKS_CACHE_SIZE;
+    constexpr int regular_big_map_chunks_array_size = regular_big_map_chunks_count ? regular_big_map_chunks_count : 1;
+    constexpr int affine_big_map_chunks_count = BN_CFG_BG_BLOCKS_AFFINE_BIG_MAP_CHUNKS_CACHE_SIZE;
+    constexpr int affine_big_map_chunks_array_size = affine_big_map_chunks_count ? affine_big_map_chunks_count : 1;
+
+
+    constexpr int streamed_tiles_count = BN_CFG_BG_BLOCKS_STREAMED_TILES_COUNT;
+    constexpr int streamed_tiles_max_uploads = BN_CFG_BG_BLOCKS_STREAMED_TILES_MAX_UPLOADS;
+    constexpr int streamed_tiles_array_size = streamed_tiles_count ? streamed_tiles_count : 1;
+    constexpr int streamed_cells_array_size = streamed_tiles_count ? 32 * 32 : 1;
+
+    static_assert(streamed_tiles_max_uploads > 0);
+
+
+    [[nodiscard]] constexpr int _streamed_tiles_map_size()
+    {
+        int result = 2;
+
+        while(result < streamed_tiles_count * 2)
+        {
+            result *= 2;
+        }
+
+        return result;
+    }
+
+
+    class streamed_tile_hasher
+    {
+
+    public:
+        [[nodiscard]] unsigned operator()(uint16_t value) const
+        {
+            return value;
+        }
+    };
+
+
+    // Tiles cache of the regular big map with streamed tiles.
+    // Physical tiles not referenced by any VRAM map cell are stored in a LRU list,
+    // and the least recently used one is replaced when a source tile is not in the cache.
+    // Source tiles are uploaded with a per frame budget, so the cells whose tiles can't be uploaded are left pending:
+    class streamed_tiles_type
+    {
+
+    public:
+        static constexpr uint16_t invalid_tile = numeric_limits<uint16_t>::max();
+
+        int map_id = -1;
+
+        void setup(int id, const uint16_t* source_cells_ptr, const uint16_t* source_tile_indexes_ptr,
+                   const tile* source_tiles_ptr, tile* vram_tiles_ptr, int tile_size)
+        {
+            map_id = id;
+            _source_cells_ptr = source_cells_ptr;
+            _source_tile_indexes_ptr = source_tile_indexes_ptr;
+            _source_tiles_ptr = source_tiles_ptr;
+            _vram_tiles_ptr = vram_tiles_ptr;
+            _tile_size = tile_size;
+            _physical_tiles.clear();
+
+            for(uint16_t& cell_tile : _cell_tiles)
+            {
+                cell_tile = invalid_tile;
+            }
+
+            for(int index = 0; index < streamed_tiles_count; ++index)
+            {
+                _source_tiles[index] = invalid_tile;
+                _usages[index] = 0;
+            }
+
+            // The last element of the LRU list is the sentinel:
+            for(int index = 0; index <= streamed_tiles_count; ++index)
+            {
+                _lru_previous[index] = uint16_t(index ? index - 1 : streamed_tiles_count);
+                _lru_next[index] = uint16_t(index < streamed_tiles_count ? index + 1 : 0);
+            }
+        }
+
+        void reset()
+        {
+            map_id = -1;
+        }
+
+        void reset_uploads()
+        {
+            _uploads_left = streamed_tiles_max_uploads;
+        }
+
+        [[nodiscard]] bool take_pending_cells()
+        {
+            bool result = _pending_cells;
+            _pending_cells = false;
+            return result;
+        }
+
+        void commit_cell(const uint16_t* source_cell_ptr, int cell_index, uint16_t offset, uint16_t* vram_data)
+        {
+            unsigned source_cell = *source_cell_ptr;
+            unsigned source_tile = _source_tile_indexes_ptr ?
+                        _source_tile_indexes_ptr[source_cell_ptr - _source_cells_ptr] : source_cell & 0x3FF;
+            unsigned physical_tile;
+
+            if(auto it = _physical_tiles.find(uint16_t(source_tile)); it != _physical_tiles.end())
+            {
+                physical_tile = it->second;
+            }
+            else if(_uploads_left)
+            {
+                --_uploads_left;
+                physical_tile = _load(source_tile);
+            }
+            else
+            {
+                _pending_cells = true;
+                return;
+            }
+
+            unsigned old_physical_tile = _cell_tiles[cell_index];
+
+            if(physical_tile != old_physical_tile)
+            {
+                if(! _usages[physical_tile])
+                {
+                    _lru_remove(physical_tile);
+                }
+
+                ++_usages[physical_tile];
+
+                if(old_physical_tile != invalid_tile)
+                {
+                    _release(old_physical_tile);
+                }
+
+                _cell_tiles[cell_index] = uint16_t(physical_tile);
+            }
+
+            vram_data[cell_index] = uint16_t(((source_cell & ~0x3FFu) | physical_tile) + offset);
+        }
+
+        void release_cells()
+        {
+            for(uint16_t& cell_tile : _cell_tiles)
+            {
+                if(cell_tile != invalid_tile)
+                {
+                    _release(cell_tile);
+                    cell_tile = invalid_tile;
+                }
+            }
+        }
+
+    private:
+        unordered_map<uint16_t, uint16_t, _streamed_tiles_map_size(), streamed_tile_hasher> _physical_tiles;
+        const uint16_t* _source_cells_ptr = nullptr;
+        const uint16_t* _source_tile_indexes_ptr = nullptr;
+        const tile* _source_tiles_ptr = nullptr;
+        tile* _vram_tiles_ptr = nullptr;
+        int _tile_size = 1;
+        int _uploads_left = streamed_tiles_max_uploads;
+        bool _pending_cells = false;
+        alignas(int) uint16_t _cell_tiles[streamed_cells_array_size];
+        alignas(int) uint16_t _source_tiles[streamed_tiles_array_size];
+        alignas(int) uint16_t _usages[streamed_tiles_array_size];
+        alignas(int) uint16_t _lru_previous[streamed_tiles_count + 1];
+        alignas(int) uint16_t _lru_next[streamed_tiles_count + 1];
+
+        [[nodiscard]] unsigned _load(unsigned source_tile)
+        {
+            unsigned result = _lru_next[streamed_tiles_count];
+            BN_ASSERT(int(result) != streamed_tiles_count, "No more streamed tiles available");
+
+            if(unsigned old_source_tile = _source_tiles[result]; old_source_tile != invalid_tile)
+            {
+                _physical_tiles.erase(uint16_t(old_source_tile));
+            }
+
+            _source_tiles[result] = uint16_t(source_tile);
+            _physical_tiles.insert(uint16_t(source_tile), uint16_t(result));
+
+            int tile_size = _tile_size;
+            hw::memory::copy_words(_source_tiles_ptr + (source_tile * tile_size), tile_size * 8,
+                                   _vram_tiles_ptr + (result * tile_size));
+            return result;
+        }
+
+        void _release(unsigned physical_tile)
+        {
+            if(! --_usages[physical_tile])
+            {
+                unsigned last = _lru_previous[streamed_tiles_count];
+                _lru_previous[physical_tile] = uint16_t(last);
+                _lru_next[physical_tile] = uint16_t(streamed_tiles_count);
+                _lru_next[last] = uint16_t(physical_tile);
+                _lru_previous[streamed_tiles_count] = uint16_t(physical_tile);
+            }
+        }
+
+        void _lru_remove(unsigned physical_tile)
+        {
+            unsigned previous = _lru_previous[physical_tile];
+            unsigned next = _lru_next[physical_tile];
+            _lru_next[previous] = uint16_t(next);
+            _lru_previous[next] = uint16_t(previous);
+        }
+    };
+
+
     class identity_hasher
     {
 
@@ -369,6 +597,10 @@ namespace
         items_list items;
         unordered_map<const void*, int, max_items * 2, identity_hasher> items_map;
         alignas(int) uint16_t to_commit_items_array[max_items];
+        big_map_chunk_type<regular_bg_map_cell> regular_big_map_chunks[regular_big_map_chunks_array_size];
+        big_map_chunk_type<affine_bg_map_cell> affine_big_map_chunks[affine_big_map_chunks_array_size];
+        streamed_tiles_type streamed_tiles;
+        unsigned big_map_chunks_usage = 0;
         int free_blocks_count = 0;
         int to_remove_blocks_count = 0;
         int to_commit_items_count = 0;
@@ -421,6 +653,12 @@ namespace
         {
             int width = dimensions.width();
             int height = dimensions.height();
+
+            BN_ASSERT(regular_big_map_chunks_count || compression == compression_type::NONE ||
+                            ! _big_regular_map(width, height),
+                      "Compressed regular big maps are disabled: ",
+                      "BN_CFG_BG_BLOCKS_REGULAR_BIG_MAP_CHUNKS_CACHE_SIZE is zero");
+
             int blocks_count = _regular_map_blocks_count(width, height);
             bpp_mode bpp = palette.bpp();
 
@@ -434,6 +672,12 @@ namespace
         {
             int width = dimensions.width();
             int height = dimensions.height();
+
+            BN_ASSERT(affine_big_map_chunks_count || compression == compression_type::NONE ||
+                            ! _big_affine_map(width, height),
+                      "Compressed affine big maps are disabled: ",
+                      "BN_CFG_BG_BLOCKS_AFFINE_BIG_MAP_CHUNKS_CACHE_SIZE is zero");
+
             int blocks_count = _affine_map_blocks_count(width, height);
             bpp_mode bpp = palette.bpp();
 
@@ -758,6 +1002,426 @@ namespace
         return -1;
     }
 
+    // Compressed big maps are stored in independently compressed 32x32 cells chunks,
+    // preceded by a table with the offset in bytes of each chunk:
+    template<typename Cell, int Size>
+    [[nodiscard]] const Cell* _big_map_chunk(const uint16_t* map_data, compression_type compression,
+                                             int chunk_index, big_map_chunk_type<Cell> (&chunks)[Size])
+    {
+        auto chunk_offsets = reinterpret_cast<const unsigned*>(map_data);
+        const uint8_t* chunk_data = reinterpret_cast<const uint8_t*>(map_data) + chunk_offsets[chunk_index];
+        unsigned usage = ++data.big_map_chunks_usage;
+        big_map_chunk_type<Cell>* result = chunks;
+
+        for(big_map_chunk_type<Cell>& chunk : chunks)
+        {
+            if(chunk.data == chunk_data)
+            {
+                chunk.last_usage = usage;
+                return chunk.cells;
+            }
+
+            if(chunk.last_usage < result->last_usage)
+            {
+                result = &chunk;
+            }
+        }
+
+        memory::decompress(compression, chunk_data, 32 * 32 * int(sizeof(Cell)), result->cells);
+        result->data = chunk_data;
+        result->last_usage = usage;
+        return result->cells;
+    }
+
+    [[nodiscard]] const regular_bg_map_cell* _regular_big_map_chunk(const uint16_t* map_data,
+                                                                    compression_type compression, int chunk_index)
+    {
+        BN_ASSERT(regular_big_map_chunks_count,
+                  "Compressed regular big maps are disabled: ",
+                  "BN_CFG_BG_BLOCKS_REGULAR_BIG_MAP_CHUNKS_CACHE_SIZE is zero");
+
+        return _big_map_chunk(map_data, compression, chunk_index, data.regular_big_map_chunks);
+    }
+
+    [[nodiscard]] const affine_bg_map_cell* _affine_big_map_chunk(const uint16_t* map_data,
+                                                                  compression_type compression, int chunk_index)
+    {
+        BN_ASSERT(affine_big_map_chunks_count,
+                  "Compressed affine big maps are disabled: ",
+                  "BN_CFG_BG_BLOCKS_AFFINE_BIG_MAP_CHUNKS_CACHE_SIZE is zero");
+
+        return _big_map_chunk(map_data, compression, chunk_index, data.affine_big_map_chunks);
+    }
+
+    [[nodiscard]] const uint16_t* _regular_big_map_chunk(const item_type& item, int chunk_x, int chunk_y)
+    {
+        int chunk_index = (chunk_y * (item.width / 32)) + chunk_x;
+        return _regular_big_map_chunk(item.data, item.compression(), chunk_index);
+    }
+
+    [[nodiscard]] const uint8_t* _affine_big_map_chunk(const item_type& item, int chunk_x, int chunk_y)
+    {
+        int chunk_index = (chunk_y * (item.width / 32)) + chunk_x;
+        return _affine_big_map_chunk(item.data, item.compression(), chunk_index);
+    }
+
+    void _invalidate_big_map_chunks()
+    {
+        for(big_map_chunk_type<regular_bg_map_cell>& chunk : data.regular_big_map_chunks)
+        {
+            chunk.data = nullptr;
+            chunk.last_usage = 0;
+        }
+
+        for(big_map_chunk_type<affine_bg_map_cell>& chunk : data.affine_big_map_chunks)
+        {
+            chunk.data = nullptr;
+            chunk.last_usage = 0;
+        }
+    }
+
+    void _regular_big_map_row_chunks(const item_type& item, int x, int y, const uint16_t*& source_data,
+                                     const uint16_t*& second_source_data)
+    {
+        int chunk_x = x / 32;
+        int chunk_y = y / 32;
+        int x_separator = x & 31;
+        int chunk_row_index = (y & 31) * 32;
+        source_data = _regular_big_map_chunk(item, chunk_x, chunk_y) + (chunk_row_index + x_separator);
+        second_source_data = source_data;
+
+        if(x_separator)
+        {
+            int next_chunk_x = chunk_x + 1;
+
+            if(next_chunk_x * 32 == item.width)
+            {
+                next_chunk_x = 0;
+            }
+
+            second_source_data = _regular_big_map_chunk(item, next_chunk_x, chunk_y) + chunk_row_index;
+        }
+    }
+
+    void _affine_big_map_row_chunks(const item_type& item, int x, int y, const uint8_t*& source_data,
+                                    const uint8_t*& second_source_data)
+    {
+        int chunk_x = x / 32;
+        int chunk_y = y / 32;
+        int x_separator = x & 31;
+        int chunk_row_index = (y & 31) * 32;
+        source_data = _affine_big_map_chunk(item, chunk_x, chunk_y) + (chunk_row_index + x_separator);
+        second_source_data = source_data;
+
+        if(x_separator)
+        {
+            int next_chunk_x = chunk_x + 1;
+
+            if(next_chunk_x * 32 == item.width)
+            {
+                next_chunk_x = 0;
+            }
+
+            second_source_data = _affine_big_map_chunk(item, next_chunk_x, chunk_y) + chunk_row_index;
+        }
+    }
+
+    // Big maps dimensions are multiple of 32 cells, so 32 cells segments never cross their edges
+    // and coordinates can be wrapped without divisions:
+    [[nodiscard]] int _wrap_big_map_coordinate(int coordinate, int dimension)
+    {
+        return coordinate < dimension ? coordinate : coordinate - dimension;
+    }
+
+    [[nodiscard]] uint16_t _regular_map_offset(const item_type& item)
+    {
+        auto tiles_offset = unsigned(item.regular_tiles_offset());
+        auto palette_offset = unsigned(item.palette_offset());
+
+        if(tiles_offset || palette_offset)
+        {
+            return hw::bg_blocks::regular_map_cells_offset(tiles_offset, palette_offset);
+        }
+
+        return 0;
+    }
+
+    [[nodiscard]] uint16_t _affine_map_offset(const item_type& item)
+    {
+        if(auto tiles_offset = unsigned(item.affine_tiles_offset()))
+        {
+            return hw::bg_blocks::affine_map_cells_offset(tiles_offset);
+        }
+
+        return 0;
+    }
+
+    void _commit_regular_map_col(const item_type& item, int x, int y, const uint16_t* source_data,
+                                 const uint16_t* second_source_data, int source_pitch, int first_rows,
+                                 int second_rows)
+    {
+        uint16_t* second_dest_data = hw::bg_blocks::vram(item.start_block) + (x & 31);
+        uint16_t* dest_data = second_dest_data + ((y & 31) * 32);
+
+        if(uint16_t offset = _regular_map_offset(item))
+        {
+            for(int iy = 0; iy < first_rows; ++iy)
+            {
+                *dest_data = *source_data + offset;
+                dest_data += 32;
+                source_data += source_pitch;
+            }
+
+            dest_data = second_dest_data;
+
+            for(int iy = 0; iy < second_rows; ++iy)
+            {
+                *dest_data = *second_source_data + offset;
+                dest_data += 32;
+                second_source_data += source_pitch;
+            }
+        }
+        else
+        {
+            for(int iy = 0; iy < first_rows; ++iy)
+            {
+                *dest_data = *source_data;
+                dest_data += 32;
+                source_data += source_pitch;
+            }
+
+            dest_data = second_dest_data;
+
+            for(int iy = 0; iy < second_rows; ++iy)
+            {
+                *dest_data = *second_source_data;
+                dest_data += 32;
+                second_source_data += source_pitch;
+            }
+        }
+    }
+
+    void _commit_affine_map_col(const item_type& item, int x, int y, const uint8_t* source_data,
+                                const uint8_t* second_source_data, int source_pitch, int first_rows,
+                                int second_rows)
+    {
+        uint8_t* second_dest_data = reinterpret_cast<uint8_t*>(hw::bg_blocks::vram(item.start_block)) + (x & 31);
+        uint8_t* dest_data = second_dest_data + ((y & 31) * 32);
+
+        if(auto tiles_offset = unsigned(item.affine_tiles_offset()))
+        {
+            if(x % 2)
+            {
+                for(int iy = 0; iy < first_rows; ++iy)
+                {
+                    auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data - 1);
+                    auto joined_value = uint16_t(((*source_data + tiles_offset) << 8) | (*u16_dest_data & 0xFF));
+                    *u16_dest_data = joined_value;
+                    dest_data += 32;
+                    source_data += source_pitch;
+                }
+
+                dest_data = second_dest_data;
+
+                for(int iy = 0; iy < second_rows; ++iy)
+                {
+                    auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data - 1);
+                    auto joined_value = uint16_t(((*second_source_data + tiles_offset) << 8) |
+                                                 (*u16_dest_data & 0xFF));
+                    *u16_dest_data = joined_value;
+                    dest_data += 32;
+                    second_source_data += source_pitch;
+                }
+            }
+            else
+            {
+                for(int iy = 0; iy < first_rows; ++iy)
+                {
+                    auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data);
+                    auto joined_value = uint16_t((*u16_dest_data & 0xFF00) | (*source_data + tiles_offset));
+                    *u16_dest_data = joined_value;
+                    dest_data += 32;
+                    source_data += source_pitch;
+                }
+
+                dest_data = second_dest_data;
+
+                for(int iy = 0; iy < second_rows; ++iy)
+                {
+                    auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data);
+                    auto joined_value = uint16_t((*u16_dest_data & 0xFF00) | (*second_source_data + tiles_offset));
+                    *u16_dest_data = joined_value;
+                    dest_data += 32;
+                    second_source_data += source_pitch;
+                }
+            }
+        }
+        else
+        {
+            if(x % 2)
+            {
+                for(int iy = 0; iy < first_rows; ++iy)
+                {
+                    auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data - 1);
+                    auto joined_value = uint16_t((unsigned(*source_data) << 8) | (*u16_dest_data & 0xFF));
+                    *u16_dest_data = joined_value;
+                    dest_data += 32;
+                    source_data += source_pitch;
+                }
+
+                dest_data = second_dest_data;
+
+                for(int iy = 0; iy < second_rows; ++iy)
+                {
+                    auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data - 1);
+                    auto joined_value = uint16_t((unsigned(*second_source_data) << 8) | (*u16_dest_data & 0xFF));
+                    *u16_dest_data = joined_value;
+                    dest_data += 32;
+                    second_source_data += source_pitch;
+                }
+            }
+            else
+            {
+                for(int iy = 0; iy < first_rows; ++iy)
+                {
+                    auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data);
+                    auto joined_value = uint16_t((*u16_dest_data & 0xFF00) | *source_data);
+                    *u16_dest_data = joined_value;
+                    dest_data += 32;
+                    source_data += source_pitch;
+                }
+
+                dest_data = second_dest_data;
+
+                for(int iy = 0; iy < second_rows; ++iy)
+                {
+                    auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data);
+                    auto joined_value = uint16_t((*u16_dest_data & 0xFF00) | *second_source_data);
+                    *u16_dest_data = joined_value;
+                    dest_data += 32;
+                    second_source_data += source_pitch;
+                }
+            }
+        }
+    }
+
+    void _commit_streamed_map_col(const item_type& item, int x, int y, const uint16_t* source_data,
+                                  const uint16_t* second_source_data, int source_pitch, int first_rows,
+                                  int second_rows)
+    {
+        streamed_tiles_type& streamed_tiles = data.streamed_tiles;
+        uint16_t* vram_data = hw::bg_blocks::vram(item.start_block);
+        uint16_t offset = _regular_map_offset(item);
+        int column = x & 31;
+        int cell_index = ((y & 31) * 32) + column;
+
+        for(int iy = 0; iy < first_rows; ++iy)
+        {
+            streamed_tiles.commit_cell(source_data, cell_index, offset, vram_data);
+            cell_index += 32;
+            source_data += source_pitch;
+        }
+
+        cell_index = column;
+
+        for(int iy = 0; iy < second_rows; ++iy)
+        {
+            streamed_tiles.commit_cell(second_source_data, cell_index, offset, vram_data);
+            cell_index += 32;
+            second_source_data += source_pitch;
+        }
+    }
+
+    void _commit_streamed_map_row(const item_type& item, int y, const uint16_t* source_data,
+                                  const uint16_t* second_source_data, int x_separator)
+    {
+        streamed_tiles_type& streamed_tiles = data.streamed_tiles;
+        uint16_t* vram_data = hw::bg_blocks::vram(item.start_block);
+        uint16_t offset = _regular_map_offset(item);
+        int row_index = (y & 31) * 32;
+
+        for(int cell_index = row_index + x_separator, limit = row_index + 32; cell_index < limit; ++cell_index)
+        {
+            streamed_tiles.commit_cell(source_data, cell_index, offset, vram_data);
+            ++source_data;
+        }
+
+        for(int cell_index = row_index, limit = row_index + x_separator; cell_index < limit; ++cell_index)
+        {
+            streamed_tiles.commit_cell(second_source_data, cell_index, offset, vram_data);
+            ++second_source_data;
+        }
+    }
+
+    void _check_streamed_map_pending_cells(int id)
+    {
+        // Pending cells are committed with a full commit in the next frames:
+        if(data.streamed_tiles.take_pending_cells())
+        {
+            item_type& item = data.items.item(id);
+            item.commit = true;
+            data.check_commit = true;
+        }
+    }
+
+    void _commit_regular_map_row(const uint16_t* source_data, const uint16_t* second_source_data, int x_separator,
+                                 uint16_t offset, bool use_dma, uint16_t* dest_data)
+    {
+        int elements = 32 - x_separator;
+
+        if(offset)
+        {
+            hw::bg_blocks::commit_offset(source_data, elements, offset, dest_data);
+            dest_data -= x_separator;
+            hw::bg_blocks::commit_offset(second_source_data, x_separator, offset, dest_data);
+        }
+        else if(use_dma)
+        {
+            hw::dma::copy_half_words(source_data, elements, dest_data);
+
+            if(x_separator)
+            {
+                hw::dma::copy_half_words(second_source_data, x_separator, dest_data - x_separator);
+            }
+        }
+        else
+        {
+            hw::memory::copy_half_words(source_data, elements, dest_data);
+            dest_data -= x_separator;
+            hw::memory::copy_half_words(second_source_data, x_separator, dest_data);
+        }
+    }
+
+    void _commit_affine_map_row(const uint8_t* source_data, const uint8_t* second_source_data, int x_separator,
+                                uint16_t offset, bool use_dma, uint8_t* dest_data)
+    {
+        int elements = 32 - x_separator;
+
+        if(offset)
+        {
+            hw::bg_blocks::commit_offset(reinterpret_cast<const uint16_t*>(source_data), elements / 2, offset,
+                                         reinterpret_cast<uint16_t*>(dest_data));
+            dest_data -= x_separator;
+            hw::bg_blocks::commit_offset(reinterpret_cast<const uint16_t*>(second_source_data), x_separator / 2,
+                                         offset, reinterpret_cast<uint16_t*>(dest_data));
+        }
+        else if(use_dma)
+        {
+            hw::dma::copy_half_words(source_data, elements / 2, dest_data);
+
+            if(x_separator)
+            {
+                hw::dma::copy_half_words(second_source_data, x_separator / 2, dest_data - x_separator);
+            }
+        }
+        else
+        {
+            hw::memory::copy_half_words(source_data, elements / 2, dest_data);
+            dest_data -= x_separator;
+            hw::memory::copy_half_words(second_source_data, x_separator / 2, dest_data);
+        }
+    }
+
     void _commit_item(const item_type& item)
     {
         const uint16_t* source_data_ptr = item.data;
@@ -922,6 +1586,7 @@ namespace
         item->set_status(status_type::USED);
         item->is_tiles = is_tiles;
         item->is_affine = create_data.is_affine;
+        item->streamed_tiles = false;
 
         bool commit_item = false;
 
@@ -1395,8 +2060,6 @@ int create_regular_map(const regular_bg_map_item& map_item, regular_bg_tiles_ptr
     BN_ASSERT(aligned<4>(data_ptr), "Map cells are not aligned");
     BN_ASSERT(regular_bg_tiles_item::valid_tiles_count(tiles.tiles_count(), palette.bpp()),
               "Invalid tiles count: ", tiles.tiles_count(), " - ", int(palette.bpp()));
-    BN_ASSERT(compression == compression_type::NONE || ! _big_regular_map(dimensions.width(), dimensions.height()),
-              "Compressed big regular maps are not supported");
 
     result = _create_impl(
                 create_data::from_regular_map(data_ptr, dimensions, compression, move(tiles), move(palette)));
@@ -1449,8 +2112,6 @@ int create_affine_map(const affine_bg_map_item& map_item, affine_bg_tiles_ptr&&
 
     BN_ASSERT(aligned<4>(data_ptr), "Map cells are not aligned");
     BN_ASSERT(palette.bpp() == bpp_mode::BPP_8, "BPP_4 affine maps not supported");
-    BN_ASSERT(compression == compression_type::NONE || ! _big_affine_map(dimensions.width(), dimensions.height()),
-              "Compressed big affine maps are not supported");
 
     result = _create_impl(
                 create_data::from_affine_map(data_ptr, dimensions, compression, move(tiles), move(palette)));
@@ -1586,8 +2247,6 @@ int create_new_regular_map(const regular_bg_map_item& map_item, regular_bg_tiles
     BN_ASSERT(aligned<4>(data_ptr), "Map cells are not aligned");
     BN_ASSERT(regular_bg_tiles_item::valid_tiles_count(tiles.tiles_count(), palette.bpp()),
               "Invalid tiles count: ", tiles.tiles_count(), " - ", int(palette.bpp()));
-    BN_ASSERT(compression == compression_type::NONE || ! _big_regular_map(dimensions.width(), dimensions.height()),
-              "Compressed big regular maps are not supported");
     BN_ASSERT(data.items_map.find(data_ptr) == data.items_map.end(),
               "Multiple copies of the same data not supported");
 
@@ -1635,8 +2294,6 @@ int create_new_affine_map(const affine_bg_map_item& map_item, affine_bg_tiles_pt
 
     BN_ASSERT(aligned<4>(data_ptr), "Map cells are not aligned");
     BN_ASSERT(palette.bpp() == bpp_mode::BPP_8, "BPP_4 affine maps not supported");
-    BN_ASSERT(compression == compression_type::NONE || ! _big_affine_map(dimensions.width(), dimensions.height()),
-              "Compressed big affine maps are not supported");
     BN_ASSERT(data.items_map.find(data_ptr) == data.items_map.end(),
               "Multiple copies of the same data not supported");
 
@@ -1671,6 +2328,53 @@ int create_new_affine_map(const affine_bg_map_item& map_item, affine_bg_tiles_pt
     return result;
 }
 
+int create_streamed_regular_map(const regular_bg_map_item& map_item, const span<const uint16_t>& tile_indexes,
+                                const regular_bg_tiles_item& tiles_item, bg_palette_ptr&& palette)
+{
+    const size& dimensions = map_item.dimensions();
+    bpp_mode bpp = palette.bpp();
+
+    BN_BG_BLOCKS_LOG("bg_blocks_manager - CREATE STREAMED REGULAR MAP: ", map_item.cells_ptr(), " - ",
+                     dimensions.width(), " - ", dimensions.height(), " - ", tile_indexes.data(), " - ",
+                     tiles_item.tiles_ref().data(), " - ", palette.id());
+
+    BN_ASSERT(streamed_tiles_count, "Streamed tiles are disabled");
+    BN_ASSERT(data.streamed_tiles.map_id < 0, "There's already a map with streamed tiles");
+    BN_ASSERT(_big_regular_map(dimensions.width(), dimensions.height()),
+              "Only big maps can stream their tiles: ", dimensions.width(), " - ", dimensions.height());
+    BN_ASSERT(tiles_item.compression() == compression_type::NONE, "Streamed tiles can't be compressed");
+    BN_ASSERT(tiles_item.bpp() == bpp, "Tiles and palette BPP mismatch: ", int(tiles_item.bpp()), " - ", int(bpp));
+
+    int tile_size = bpp == bpp_mode::BPP_8 ? 2 : 1;
+    BN_ASSERT(tiles_item.tiles_ref().size() / tile_size < streamed_tiles_type::invalid_tile,
+              "Too many source tiles: ", tiles_item.tiles_ref().size() / tile_size);
+
+    const uint16_t* tile_indexes_ptr = nullptr;
+
+    if(! tile_indexes.empty())
+    {
+        BN_ASSERT(map_item.compression() == compression_type::NONE,
+                  "Maps with tile indexes can't be compressed");
+        BN_ASSERT(tile_indexes.size() == dimensions.width() * dimensions.height(),
+                  "Invalid tile indexes count: ", tile_indexes.size(), " - ",
+                  dimensions.width() * dimensions.height());
+
+        tile_indexes_ptr = tile_indexes.data();
+    }
+
+    BN_ASSERT(streamed_tiles_count * tile_size <= available_tiles_count(),
+              "Not enough available VRAM tiles for streamed tiles: ", streamed_tiles_count * tile_size, " - ",
+              available_tiles_count(), " (see BN_CFG_BG_BLOCKS_STREAMED_TILES_COUNT)");
+
+    regular_bg_tiles_ptr tiles = regular_bg_tiles_ptr::allocate(streamed_tiles_count * tile_size, bpp);
+    auto vram_tiles_ptr = reinterpret_cast<tile*>(hw::bg_blocks::vram(tiles.id()));
+    int result = create_new_regular_map(map_item, move(tiles), move(palette), false);
+    data.items.item(result).streamed_tiles = true;
+    data.streamed_tiles.setup(result, map_item.cells_ptr(), tile_indexes_ptr, tiles_item.tiles_ref().data(),
+                              vram_tiles_ptr, tile_size);
+    return result;
+}
+
 int allocate_regular_tiles(int tiles_count, bpp_mode bpp, bool optional)
 {
     int half_words = _tiles_to_half_words(tiles_count);
@@ -1853,6 +2557,12 @@ void decrease_usages(int id)
 
     if(! item.usages)
     {
+        if(item.streamed_tiles)
+        {
+            item.streamed_tiles = false;
+            data.streamed_tiles.reset();
+        }
+
         item.set_status(status_type::TO_REMOVE);
         data.to_remove_blocks_count += item.blocks_count;
 
@@ -2055,8 +2765,11 @@ void set_regular_map_cells_ref(int id, const regular_bg_map_item& map_item)
               map_item.dimensions().width(), " - ", item.width);
     BN_ASSERT(map_item.dimensions().height() == item.height, "Map height does not match item map height: ",
               map_item.dimensions().height(), " - ", item.height);
-    BN_ASSERT(compression == compression_type::NONE || ! _big_regular_map(item.width, item.height),
-              "Compressed big regular maps are not supported");
+
+    if(compression != compression_type::NONE)
+    {
+        _invalidate_big_map_chunks();
+    }
 
     if(item_data != data_ptr)
     {
@@ -2100,8 +2813,11 @@ void set_affine_map_cells_ref(int id, const affine_bg_map_item& map_item)
               map_item.dimensions().width(), " - ", item.width);
     BN_ASSERT(map_item.dimensions().height() == item.height, "Map height does not match item map height: ",
               map_item.dimensions().height(), " - ", item.height);
-    BN_ASSERT(compression == compression_type::NONE || ! _big_affine_map(item.width, item.height),
-              "Compressed big affine maps are not supported");
+
+    if(compression != compression_type::NONE)
+    {
+        _invalidate_big_map_chunks();
+    }
 
     if(item_data != data_ptr)
     {
@@ -2137,6 +2853,11 @@ void reload(int id)
     item_type& item = data.items.item(id);
     BN_ASSERT(item.data, "Item has no data");
 
+    if(item.compression() != compression_type::NONE)
+    {
+        _invalidate_big_map_chunks();
+    }
+
     item.commit = true;
     data.check_commit = true;
 
@@ -2161,6 +2882,7 @@ void set_regular_map_tiles(int id, regular_bg_tiles_ptr&& tiles)
 
     if(tiles != item.regular_tiles)
     {
+        BN_ASSERT(! item.streamed_tiles, "Maps with streamed tiles can't change their tiles");
         BN_ASSERT(regular_bg_tiles_item::valid_tiles_count(tiles.tiles_count(), item.palette->bpp()),
                   "Invalid tiles count: ", tiles.tiles_count(), " - ", int(item.palette->bpp()));
 
@@ -2314,6 +3036,7 @@ void set_regular_map_tiles_and_palette(int id, regular_bg_tiles_ptr&& tiles, bg_
 {
     item_type& item = data.items.item(id);
     bpp_mode new_palette_bpp = palette.bpp();
+    BN_ASSERT(! item.streamed_tiles || tiles == item.regular_tiles, "Maps with streamed tiles can't change their tiles");
     BN_ASSERT(regular_bg_tiles_item::valid_tiles_count(tiles.tiles_count(), new_palette_bpp),
               "Invalid tiles count or palette BPP: ", tiles.tiles_count(), " - ", int(new_palette_bpp));
 
@@ -2407,13 +3130,43 @@ optional<span<affine_bg_map_cell>> affine_map_vram(int id)
     return result;
 }
 
+void decompress_big_map(const void* data_ptr, compression_type compression, const size& dimensions, bool affine,
+                        void* destination_ptr)
+{
+    auto map_data = static_cast<const uint16_t*>(data_ptr);
+    auto destination_data = static_cast<uint8_t*>(destination_ptr);
+    int cell_bytes = affine ? int(sizeof(affine_bg_map_cell)) : int(sizeof(regular_bg_map_cell));
+    int chunk_row_bytes = 32 * cell_bytes;
+    int chunks_per_row = dimensions.width() / 32;
+    int pitch = dimensions.width() * cell_bytes;
+
+    for(int chunk_y = 0, chunks_per_col = dimensions.height() / 32; chunk_y < chunks_per_col; ++chunk_y)
+    {
+        for(int chunk_x = 0; chunk_x < chunks_per_row; ++chunk_x)
+        {
+            int chunk_index = (chunk_y * chunks_per_row) + chunk_x;
+            const uint8_t* chunk_data = affine ?
+                        _affine_big_map_chunk(map_data, compression, chunk_index) :
+                        reinterpret_cast<const uint8_t*>(_regular_big_map_chunk(map_data, compression, chunk_index));
+            uint8_t* chunk_destination_data = destination_data + (chunk_y * 32 * pitch) + (chunk_x * chunk_row_bytes);
+
+            for(int row = 0; row < 32; ++row)
+            {
+                hw::memory::copy_half_words(chunk_data, chunk_row_bytes / 2, chunk_destination_data);
+                chunk_data += chunk_row_bytes;
+                chunk_destination_data += pitch;
+            }
+        }
+    }
+}
+
 bool must_commit(int id)
 {
     const item_type& item = data.items.item(id);
     return item.commit;
 }
 
-void update_regular_map_col(int id, int x, int y)
+void update_regular_map_col(int id, int x, int y, int rows)
 {
     const item_type& item = data.items.item(id);
     const uint16_t* source_data = item.data;
@@ -2424,54 +3177,54 @@ void update_regular_map_col(int id, int x, int y)
     }
 
     int map_width = item.width;
-    source_data += ((y * map_width) + x);
+    int map_height = item.height;
+    x = _wrap_big_map_coordinate(x, map_width);
+    y = _wrap_big_map_coordinate(y, map_height);
 
     int y_separator = y & 31;
-    uint16_t* dest_data = hw::bg_blocks::vram(item.start_block) + ((y_separator * 32) + (x & 31));
-    auto tiles_offset = unsigned(item.regular_tiles_offset());
-    auto palette_offset = unsigned(item.palette_offset());
+    int next_chunk_y = (y - y_separator) + 32;
+    const uint16_t* second_source_data;
+    int source_pitch;
+    int first_rows = min(rows, 32 - y_separator);
+    int second_rows = rows - first_rows;
 
-    if(tiles_offset || palette_offset)
+    if(next_chunk_y == map_height)
     {
-        uint16_t offset = hw::bg_blocks::regular_map_cells_offset(tiles_offset, palette_offset);
-
-        for(int iy = y_separator; iy < 32; ++iy)
-        {
-            *dest_data = *source_data + offset;
-            dest_data += 32;
-            source_data += map_width;
-        }
-
-        dest_data -= 1024;
+        next_chunk_y = 0;
+    }
 
-        for(int iy = 0; iy < y_separator; ++iy)
-        {
-            *dest_data = *source_data + offset;
-            dest_data += 32;
-            source_data += map_width;
-        }
+    if(item.compression() == compression_type::NONE)
+    {
+        second_source_data = source_data + ((next_chunk_y * map_width) + x);
+        source_data += ((y * map_width) + x);
+        source_pitch = map_width;
     }
     else
     {
-        for(int iy = y_separator; iy < 32; ++iy)
-        {
-            *dest_data = *source_data;
-            dest_data += 32;
-            source_data += map_width;
-        }
-
-        dest_data -= 1024;
+        int chunk_x = x / 32;
+        int chunk_col = x & 31;
+        source_data = _regular_big_map_chunk(item, chunk_x, y / 32) + ((y_separator * 32) + chunk_col);
+        second_source_data = source_data;
+        source_pitch = 32;
 
-        for(int iy = 0; iy < y_separator; ++iy)
+        if(second_rows)
         {
-            *dest_data = *source_data;
-            dest_data += 32;
-            source_data += map_width;
+            second_source_data = _regular_big_map_chunk(item, chunk_x, next_chunk_y / 32) + chunk_col;
         }
     }
+
+    if(item.streamed_tiles)
+    {
+        _commit_streamed_map_col(item, x, y, source_data, second_source_data, source_pitch, first_rows, second_rows);
+        _check_streamed_map_pending_cells(id);
+    }
+    else
+    {
+        _commit_regular_map_col(item, x, y, source_data, second_source_data, source_pitch, first_rows, second_rows);
+    }
 }
 
-void update_affine_map_col(int id, int x, int y)
+void update_affine_map_col(int id, int x, int y, int rows)
 {
     const item_type& item = data.items.item(id);
     auto source_data = reinterpret_cast<const uint8_t*>(item.data);
@@ -2482,109 +3235,46 @@ void update_affine_map_col(int id, int x, int y)
     }
 
     int map_width = item.width;
-    source_data += ((y * map_width) + x);
+    int map_height = item.height;
+    x = _wrap_big_map_coordinate(x, map_width);
+    y = _wrap_big_map_coordinate(y, map_height);
 
     int y_separator = y & 31;
-    auto dest_data = reinterpret_cast<uint8_t*>(hw::bg_blocks::vram(item.start_block));
-    dest_data += ((y_separator * 32) + (x & 31));
+    int next_chunk_y = (y - y_separator) + 32;
+    const uint8_t* second_source_data;
+    int source_pitch;
+    int first_rows = min(rows, 32 - y_separator);
+    int second_rows = rows - first_rows;
 
-    if(auto tiles_offset = unsigned(item.affine_tiles_offset()))
+    if(next_chunk_y == map_height)
     {
-        if(x % 2)
-        {
-            for(int iy = y_separator; iy < 32; ++iy)
-            {
-                auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data - 1);
-                auto joined_value = uint16_t(((*source_data + tiles_offset) << 8) | (*u16_dest_data & 0xFF));
-                *u16_dest_data = joined_value;
-                dest_data += 32;
-                source_data += map_width;
-            }
-
-            dest_data -= 1024;
-
-            for(int iy = 0; iy < y_separator; ++iy)
-            {
-                auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data - 1);
-                auto joined_value = uint16_t(((*source_data + tiles_offset) << 8) | (*u16_dest_data & 0xFF));
-                *u16_dest_data = joined_value;
-                dest_data += 32;
-                source_data += map_width;
-            }
-        }
-        else
-        {
-            for(int iy = y_separator; iy < 32; ++iy)
-            {
-                auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data);
-                auto joined_value = uint16_t((*u16_dest_data & 0xFF00) | (*source_data + tiles_offset));
-                *u16_dest_data = joined_value;
-                dest_data += 32;
-                source_data += map_width;
-            }
-
-            dest_data -= 1024;
+        next_chunk_y = 0;
+    }
 
-            for(int iy = 0; iy < y_separator; ++iy)
-            {
-                auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data);
-                auto joined_value = uint16_t((*u16_dest_data & 0xFF00) | (*source_data + tiles_offset));
-                *u16_dest_data = joined_value;
-                dest_data += 32;
-                source_data += map_width;
-            }
-        }
+    if(item.compression() == compression_type::NONE)
+    {
+        second_source_data = source_data + ((next_chunk_y * map_width) + x);
+        source_data += ((y * map_width) + x);
+        source_pitch = map_width;
     }
     else
     {
-        if(x % 2)
-        {
-            for(int iy = y_separator; iy < 32; ++iy)
-            {
-                auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data - 1);
-                auto joined_value = uint16_t((unsigned(*source_data) << 8) | (*u16_dest_data & 0xFF));
-                *u16_dest_data = joined_value;
-                dest_data += 32;
-                source_data += map_width;
-            }
-
-            dest_data -= 1024;
+        int chunk_x = x / 32;
+        int chunk_col = x & 31;
+        source_data = _affine_big_map_chunk(item, chunk_x, y / 32) + ((y_separator * 32) + chunk_col);
+        second_source_data = source_data;
+        source_pitch = 32;
 
-            for(int iy = 0; iy < y_separator; ++iy)
-            {
-                auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data - 1);
-                uint16_t joined_value = uint16_t((unsigned(*source_data) << 8) | (*u16_dest_data & 0xFF));
-                *u16_dest_data = joined_value;
-                dest_data += 32;
-                source_data += map_width;
-            }
-        }
-        else
+        if(second_rows)
         {
-            for(int iy = y_separator; iy < 32; ++iy)
-            {
-                auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data);
-                uint16_t joined_value = uint16_t((*u16_dest_data & 0xFF00) | *source_data);
-                *u16_dest_data = joined_value;
-                dest_data += 32;
-                source_data += map_width;
-            }
-
-            dest_data -= 1024;
-
-            for(int iy = 0; iy < y_separator; ++iy)
-            {
-                auto u16_dest_data = reinterpret_cast<uint16_t*>(dest_data);
-                uint16_t joined_value = uint16_t((*u16_dest_data & 0xFF00) | *source_data);
-                *u16_dest_data = joined_value;
-                dest_data += 32;
-                source_data += map_width;
-            }
+            second_source_data = _affine_big_map_chunk(item, chunk_x, next_chunk_y / 32) + chunk_col;
         }
     }
+
+    _commit_affine_map_col(item, x, y, source_data, second_source_data, source_pitch, first_rows, second_rows);
 }
 
-void update_regular_map_row(int id, int x, int y)
+void update_regular_map_row(int id, int x, int y, bool use_dma)
 {
     const item_type& item = data.items.item(id);
     const uint16_t* source_data = item.data;
@@ -2594,32 +3284,38 @@ void update_regular_map_row(int id, int x, int y)
         return;
     }
 
-    source_data += ((y * item.width) + x);
+    int map_width = item.width;
+    x = _wrap_big_map_coordinate(x, map_width);
+    y = _wrap_big_map_coordinate(y, item.height);
 
     int x_separator = x & 31;
-    int elements = 32 - x_separator;
     uint16_t* dest_data = hw::bg_blocks::vram(item.start_block) + (((y & 31) * 32) + x_separator);
-    auto tiles_offset = unsigned(item.regular_tiles_offset());
-    auto palette_offset = unsigned(item.palette_offset());
+    const uint16_t* second_source_data;
 
-    if(tiles_offset || palette_offset)
+    if(item.compression() == compression_type::NONE)
     {
-        uint16_t offset = hw::bg_blocks::regular_map_cells_offset(tiles_offset, palette_offset);
-        hw::bg_blocks::commit_offset(source_data, elements, offset, dest_data);
-        source_data += elements;
-        dest_data -= x_separator;
-        hw::bg_blocks::commit_offset(source_data, x_separator, offset, dest_data);
+        source_data += (y * map_width);
+        second_source_data = source_data + _wrap_big_map_coordinate((x - x_separator) + 32, map_width);
+        source_data += x;
     }
     else
     {
-        hw::memory::copy_half_words(source_data, elements, dest_data);
-        source_data += elements;
-        dest_data -= x_separator;
-        hw::memory::copy_half_words(source_data, x_separator, dest_data);
+        _regular_big_map_row_chunks(item, x, y, source_data, second_source_data);
+    }
+
+    if(item.streamed_tiles)
+    {
+        _commit_streamed_map_row(item, y, source_data, second_source_data, x_separator);
+        _check_streamed_map_pending_cells(id);
+    }
+    else
+    {
+        _commit_regular_map_row(source_data, second_source_data, x_separator, _regular_map_offset(item), use_dma,
+                                dest_data);
     }
 }
 
-void update_affine_map_row(int id, int x, int y)
+void update_affine_map_row(int id, int x, int y, bool use_dma)
 {
     // BN_ASSERT(x % 2 == 0, "Invalid x: ", x);
 
@@ -2631,33 +3327,32 @@ void update_affine_map_row(int id, int x, int y)
         return;
     }
 
-    source_data += ((y * item.width) + x);
+    int map_width = item.width;
+    x = _wrap_big_map_coordinate(x, map_width);
+    y = _wrap_big_map_coordinate(y, item.height);
 
     int x_separator = x & 31;
-    int elements = 32 - x_separator;
     auto dest_data = reinterpret_cast<uint8_t*>(hw::bg_blocks::vram(item.start_block));
     dest_data += ((y & 31) * 32) + x_separator;
 
-    if(auto tiles_offset = unsigned(item.affine_tiles_offset()))
+    const uint8_t* second_source_data;
+
+    if(item.compression() == compression_type::NONE)
     {
-        uint16_t offset = hw::bg_blocks::affine_map_cells_offset(tiles_offset);
-        hw::bg_blocks::commit_offset(reinterpret_cast<const uint16_t*>(source_data), elements / 2, offset,
-                                     reinterpret_cast<uint16_t*>(dest_data));
-        source_data += elements;
-        dest_data -= x_separator;
-        hw::bg_blocks::commit_offset(reinterpret_cast<const uint16_t*>(source_data), x_separator / 2, offset,
-                                     reinterpret_cast<uint16_t*>(dest_data));
+        source_data += (y * map_width);
+        second_source_data = source_data + _wrap_big_map_coordinate((x - x_separator) + 32, map_width);
+        source_data += x;
     }
     else
     {
-        hw::memory::copy_half_words(source_data, elements / 2, dest_data);
-        source_data += elements;
-        dest_data -= x_separator;
-        hw::memory::copy_half_words(source_data, x_separator / 2, dest_data);
+        _affine_big_map_row_chunks(item, x, y, source_data, second_source_data);
     }
+
+    _commit_affine_map_row(source_data, second_source_data, x_separator, _affine_map_offset(item), use_dma,
+                            dest_data);
 }
 
-void set_regular_map_position(int id, int x, int y)
+void set_regular_map_position(int id, int x, int y, bool use_dma)
 {
     const item_type& item = data.items.item(id);
     const uint16_t* item_data = item.data;
@@ -2669,40 +3364,56 @@ void set_regular_map_position(int id, int x, int y)
 
     uint16_t* vram_data = hw::bg_blocks::vram(item.start_block);
     int map_width = item.width;
+    int map_height = item.height;
+    x = _wrap_big_map_coordinate(x, map_width);
+    y = _wrap_big_map_coordinate(y, map_height);
+
     int x_separator = x & 31;
-    int elements = 32 - x_separator;
-    auto tiles_offset = unsigned(item.regular_tiles_offset());
-    auto palette_offset = unsigned(item.palette_offset());
+    int second_x = _wrap_big_map_coordinate((x - x_separator) + 32, map_width);
+    uint16_t offset = _regular_map_offset(item);
+    bool compressed = item.compression() != compression_type::NONE;
+    bool streamed_tiles = item.streamed_tiles;
 
-    if(tiles_offset || palette_offset)
+    if(streamed_tiles)
     {
-        uint16_t offset = hw::bg_blocks::regular_map_cells_offset(tiles_offset, palette_offset);
+        data.streamed_tiles.release_cells();
+    }
 
-        for(int row = y, row_limit = y + 22; row < row_limit; ++row)
+    for(int row = y, row_limit = y + 22; row < row_limit; ++row)
+    {
+        int map_row = _wrap_big_map_coordinate(row, map_height);
+        const uint16_t* source_data;
+        const uint16_t* second_source_data;
+        uint16_t* dest_data = vram_data + (((row & 31) * 32) + x_separator);
+
+        if(compressed)
         {
-            const uint16_t* source_data = item_data + ((row * map_width) + x);
-            uint16_t* dest_data = vram_data + (((row & 31) * 32) + x_separator);
-            hw::bg_blocks::commit_offset(source_data, elements, offset, dest_data);
-            source_data += elements;
-            dest_data -= x_separator;
-            hw::bg_blocks::commit_offset(source_data, x_separator, offset, dest_data);
+            _regular_big_map_row_chunks(item, x, map_row, source_data, second_source_data);
         }
-    }
-    else
-    {
-        for(int row = y, row_limit = y + 22; row < row_limit; ++row)
+        else
         {
-            const uint16_t* source_data = item_data + ((row * map_width) + x);
-            uint16_t* dest_data = vram_data + (((row & 31) * 32) + x_separator);
-            hw::memory::copy_half_words(source_data, elements, dest_data);
-            source_data += elements;
-            dest_data -= x_separator;
-            hw::memory::copy_half_words(source_data, x_separator, dest_data);
+            const uint16_t* row_data = item_data + (map_row * map_width);
+            source_data = row_data + x;
+            second_source_data = row_data + second_x;
         }
+
+        if(streamed_tiles)
+        {
+            _commit_streamed_map_row(item, row, source_data, second_source_data, x_separator);
+        }
+        else
+        {
+            _commit_regular_map_row(source_data, second_source_data, x_separator, offset, use_dma, dest_data);
+        }
+    }
+
+    if(streamed_tiles)
+    {
+        _check_streamed_map_pending_cells(id);
     }
 }
 
-void set_affine_map_position(int id, int x, int y)
+void set_affine_map_position(int id, int x, int y, bool use_dma)
 {
     // BN_ASSERT(x % 2 == 0, "Invalid x: ", x);
 
@@ -2716,36 +3427,34 @@ void set_affine_map_position(int id, int x, int y)
 
     auto vram_data = reinterpret_cast<uint8_t*>(hw::bg_blocks::vram(item.start_block));
     int map_width = item.width;
+    int map_height = item.height;
+    x = _wrap_big_map_coordinate(x, map_width);
+    y = _wrap_big_map_coordinate(y, map_height);
+
     int x_separator = x & 31;
-    int elements = 32 - x_separator;
+    int second_x = _wrap_big_map_coordinate((x - x_separator) + 32, map_width);
+    uint16_t offset = _affine_map_offset(item);
+    bool compressed = item.compression() != compression_type::NONE;
 
-    if(auto tiles_offset = unsigned(item.affine_tiles_offset()))
+    for(int row = y, row_limit = y + 22; row < row_limit; ++row)
     {
-        uint16_t offset = hw::bg_blocks::affine_map_cells_offset(tiles_offset);
+        int map_row = _wrap_big_map_coordinate(row, map_height);
+        const uint8_t* source_data;
+        const uint8_t* second_source_data;
+        uint8_t* dest_data = vram_data + (((row & 31) * 32) + x_separator);
 
-        for(int row = y, row_limit = y + 22; row < row_limit; ++row)
+        if(compressed)
         {
-            const uint8_t* source_data = item_data + ((row * map_width) + x);
-            uint8_t* dest_data = vram_data + (((row & 31) * 32) + x_separator);
-            hw::bg_blocks::commit_offset(reinterpret_cast<const uint16_t*>(source_data), elements / 2, offset,
-                                         reinterpret_cast<uint16_t*>(dest_data));
-            source_data += elements;
-            dest_data -= x_separator;
-            hw::bg_blocks::commit_offset(reinterpret_cast<const uint16_t*>(source_data), x_separator / 2, offset,
-                                         reinterpret_cast<uint16_t*>(dest_data));
+            _affine_big_map_row_chunks(item, x, map_row, source_data, second_source_data);
         }
-    }
-    else
-    {
-        for(int row = y, row_limit = y + 22; row < row_limit; ++row)
+        else
         {
-            const uint8_t* source_data = item_data + ((row * map_width) + x);
-            uint8_t* dest_data = vram_data + (((row & 31) * 32) + x_separator);
-            hw::memory::copy_half_words(source_data, elements / 2, dest_data);
-            source_data += elements;
-            dest_data -= x_separator;
-            hw::memory::copy_half_words(source_data, x_separator / 2, dest_data);
+            const uint8_t* row_data = item_data + (map_row * map_width);
+            source_data = row_data + x;
+            second_source_data = row_data + second_x;
         }
+
+        _commit_affine_map_row(source_data, second_source_data, x_separator, offset, use_dma, dest_data);
     }
 }
 
@@ -2827,6 +3536,7 @@ void update()
     }
 
     data.delay_commit = false;
+    data.streamed_tiles.reset_uploads();
 }
 
 void commit()
@@ -85,6 +85,10 @@ namespace bn::bg_blocks_manager
     [[nodiscard]] int create_new_affine_map(const affine_bg_map_item& map_item, affine_bg_tiles_ptr&& tiles,
                                             bg_palette_ptr&& palette, bool optional);
 
+    [[nodiscard]] int create_streamed_regular_map(const regular_bg_map_item& map_item,
+                                                  const span<const uint16_t>& tile_indexes,
+                                                  const regular_bg_tiles_item& tiles_item, bg_palette_ptr&& palette);
+
     [[nodiscard]] int allocate_regular_tiles(int tiles_count, bpp_mode bpp, bool optional);
 
     [[nodiscard]] int allocate_affine_tiles(int tiles_count, bool optional);
@@ -163,19 +167,22 @@ namespace bn::bg_blocks_manager
 
     [[nodiscard]] optional<span<affine_bg_map_cell>> affine_map_vram(int id);
 
+    void decompress_big_map(const void* data_ptr, compression_type compression, const size& dimensions, bool affine,
+                            void* destination_ptr);
+
     [[nodiscard]] bool must_commit(int id);
 
-    void update_regular_map_col(int id, int x, int y);
+    void update_regular_map_col(int id, int x, int y, int rows);
 
-    void update_affine_map_col(int id, int x, int y);
+    void update_affine_map_col(int id, int x, int y, int rows);
 
-    void update_regular_map_row(int id, int x, int y);
+    void update_regular_map_row(int id, int x, int y, bool use_dma);
 
-    void update_affine_map_row(int id, int x, int y);
+    void update_affine_map_row(int id, int x, int y, bool use_dma);
 
-    void set_regular_map_position(int id, int x, int y);
+    void set_regular_map_position(int id, int x, int y, bool use_dma);
 
-    void set_affine_map_position(int id, int x, int y);
+    void set_affine_map_position(int id, int x, int y, bool use_dma);
 
     void update();
 
@@ -270,11 +270,6 @@ namespace
         {
             if(big_map)
             {
-                BN_ASSERT(hw_position.x() >= 0 &&
-                          hw_position.x() <= (half_dimensions.width() * 2) - display::width(),
-                          "Regular BGs with big maps\ndon't allow horizontal wrapping: ",
-                          hw_position.x(), " - ", (half_dimensions.width() * 2) - display::width());
-
                 commit_big_map = true;
             }
         }
@@ -283,11 +278,6 @@ namespace
         {
             if(big_map)
             {
-                BN_ASSERT(hw_position.y() >= 0 &&
-                          hw_position.y() <= (half_dimensions.height() * 2) - display::height(),
-                          "Regular BGs with big maps\ndon't allow vertical wrapping: ",
-                          hw_position.y(), " - ", (half_dimensions.height() * 2) - display::height());
-
                 commit_big_map = true;
             }
         }
@@ -313,11 +303,6 @@ namespace
 
             if(big_map)
             {
-                BN_ASSERT(affine_map_position().x() >= 0 &&
-                          affine_map_position().x() <= (half_dimensions.width() / 4) - (display::width() / 8),
-                          "Affine BGs with big maps\ndon't allow horizontal wrapping: ",
-                          affine_map_position().x(), " - ", (half_dimensions.width() / 4) - (display::width() / 8));
-
                 commit_big_map = true;
             }
         }
@@ -330,11 +315,6 @@ namespace
 
             if(big_map)
             {
-                BN_ASSERT(affine_map_position().y() >= 0 &&
-                          affine_map_position().y() <= (half_dimensions.height() / 4) - (display::height() / 8),
-                          "Affine BGs with big maps\ndon't allow vertical wrapping: ",
-                          affine_map_position().y(), " - ", (half_dimensions.height() / 4) - (display::height() / 8));
-
                 commit_big_map = true;
             }
         }
@@ -460,6 +440,29 @@ namespace
         }
     }
 
+    [[nodiscard]] int _wrap_big_map_position(int position, int dimension)
+    {
+        int result = position % dimension;
+        return result < 0 ? result + dimension : result;
+    }
+
+    // Shortest displacement between two wrapped big map positions:
+    [[nodiscard]] int _big_map_delta(int new_position, int old_position, int dimension)
+    {
+        int result = new_position - old_position;
+
+        if(result > dimension / 2)
+        {
+            result -= dimension;
+        }
+        else if(result < -dimension / 2)
+        {
+            result += dimension;
+        }
+
+        return result;
+    }
+
     void _update_big_maps()
     {
         for(item_type* item : data.items_vector)
@@ -467,6 +470,8 @@ namespace
             if(item->big_map)
             {
                 regular_bg_map_ptr* item_regular_map = item->regular_map.get();
+                int map_width = item->half_dimensions.width() / 4;
+                int map_height = item->half_dimensions.height() / 4;
                 int old_map_x = item->old_big_map_x;
                 int old_map_y = item->old_big_map_y;
                 int new_map_x;
@@ -474,14 +479,14 @@ namespace
 
                 if(item_regular_map)
                 {
-                    new_map_x = item->hw_position.x() >> 3;
-                    new_map_y = item->hw_position.y() >> 3;
+                    new_map_x = _wrap_big_map_position(item->hw_position.x() >> 3, map_width);
+                    new_map_y = _wrap_big_map_position(item->hw_position.y() >> 3, map_height);
                 }
                 else
                 {
                     point affine_map_position = item->affine_map_position();
-                    new_map_x = affine_map_position.x();
-                    new_map_y = affine_map_position.y();
+                    new_map_x = _wrap_big_map_position(affine_map_position.x(), map_width);
+                    new_map_y = _wrap_big_map_position(affine_map_position.y(), map_height);
 
                     if(new_map_x % 2)
                     {
@@ -489,9 +494,6 @@ namespace
                     }
                 }
 
-                new_map_x = min(new_map_x, (item->half_dimensions.width() / 4) - 32);
-                new_map_y = min(new_map_y, (item->half_dimensions.height() / 4) - 22);
-
                 int map_handle = item_regular_map ? item_regular_map->handle() : item->affine_map->handle();
                 bool full_commit_big_map = item->full_commit_big_map || bg_blocks_manager::must_commit(map_handle);
                 bool commit_big_map = full_commit_big_map;
@@ -506,8 +508,9 @@ namespace
                     item->new_big_map_x = uint16_t(new_map_x);
                     item->new_big_map_y = uint16_t(new_map_y);
                     item->commit_big_map = true;
-                    item->full_commit_big_map = full_commit_big_map || bn::abs(new_map_x - old_map_x) > 8 ||
-                            bn::abs(new_map_y - old_map_y) > 8;
+                    item->full_commit_big_map = full_commit_big_map ||
+                            bn::abs(_big_map_delta(new_map_x, old_map_x, map_width)) > 8 ||
+                            bn::abs(_big_map_delta(new_map_y, old_map_y, map_height)) > 8;
                 }
             }
         }
@@ -1720,7 +1723,7 @@ void commit(bool use_dma)
     }
 }
 
-void commit_big_maps()
+void commit_big_maps(bool use_dma)
 {
     for(item_type* item : data.items_vector)
     {
@@ -1742,65 +1745,49 @@ void commit_big_maps()
 
                 if(item_regular_map)
                 {
-                    bg_blocks_manager::set_regular_map_position(map_handle, new_map_x, new_map_y);
+                    bg_blocks_manager::set_regular_map_position(map_handle, new_map_x, new_map_y, use_dma);
                 }
                 else
                 {
-                    bg_blocks_manager::set_affine_map_position(map_handle, new_map_x, new_map_y);
+                    bg_blocks_manager::set_affine_map_position(map_handle, new_map_x, new_map_y, use_dma);
                 }
             }
             else
             {
+                // Scroll deltas are accumulated until the next commit, so only the newly visible strips are committed.
+                // Rows are committed in full, so columns only commit the rows not committed by them.
+                // Coordinates are not wrapped, but they are always lower than twice the map size:
+                int delta_x = _big_map_delta(new_map_x, old_map_x, item->half_dimensions.width() / 4);
+                int delta_y = _big_map_delta(new_map_y, old_map_y, item->half_dimensions.height() / 4);
+                int cols_x = delta_x > 0 ? new_map_x + 32 - delta_x : new_map_x;
+                int cols_y = delta_y < 0 ? new_map_y - delta_y : new_map_y;
+                int cols_count = bn::abs(delta_x);
+                int rows_y = delta_y > 0 ? new_map_y + 22 - delta_y : new_map_y;
+                int rows_count = bn::abs(delta_y);
+                int col_rows = 22 - rows_count;
+
                 if(item_regular_map)
                 {
-                    while(new_map_x < old_map_x)
-                    {
-                        --old_map_x;
-                        bg_blocks_manager::update_regular_map_col(map_handle, old_map_x, new_map_y);
-                    }
-
-                    while(new_map_x > old_map_x)
+                    for(int index = 0; index < cols_count; ++index)
                     {
-                        ++old_map_x;
-                        bg_blocks_manager::update_regular_map_col(map_handle, old_map_x + 31, new_map_y);
+                        bg_blocks_manager::update_regular_map_col(map_handle, cols_x + index, cols_y, col_rows);
                     }
 
-                    while(new_map_y < old_map_y)
+                    for(int index = 0; index < rows_count; ++index)
                     {
-                        --old_map_y;
-                        bg_blocks_manager::update_regular_map_row(map_handle, new_map_x, old_map_y);
-                    }
-
-                    while(new_map_y > old_map_y)
-                    {
-                        ++old_map_y;
-                        bg_blocks_manager::update_regular_map_row(map_handle, new_map_x, old_map_y + 21);
+                        bg_blocks_manager::update_regular_map_row(map_handle, new_map_x, rows_y + index, use_dma);
                     }
                 }
                 else
                 {
-                    while(new_map_x < old_map_x)
-                    {
-                        --old_map_x;
-                        bg_blocks_manager::update_affine_map_col(map_handle, old_map_x, new_map_y);
-                    }
-
-                    while(new_map_x > old_map_x)
-                    {
-                        ++old_map_x;
-                        bg_blocks_manager::update_affine_map_col(map_handle, old_map_x + 31, new_map_y);
-                    }
-
-                    while(new_map_y < old_map_y)
+                    for(int index = 0; index < cols_count; ++index)
                     {
-                        --old_map_y;
-                        bg_blocks_manager::update_affine_map_row(map_handle, new_map_x, old_map_y);
+                        bg_blocks_manager::update_affine_map_col(map_handle, cols_x + index, cols_y, col_rows);
                     }
 
-                    while(new_map_y > old_map_y)
+                    for(int index = 0; index < rows_count; ++index)
                     {
-                        ++old_map_y;
-                        bg_blocks_manager::update_affine_map_row(map_handle, new_map_x, old_map_y + 21);
+                        bg_blocks_manager::update_affine_map_row(map_handle, new_map_x, rows_y + index, use_dma);
                     }
                 }
             }
@@ -210,7 +210,7 @@ namespace bgs_manager
 
     void commit(bool use_dma);
 
-    void commit_big_maps();
+    void commit_big_maps(bool use_dma);
 
     void stop();
 }
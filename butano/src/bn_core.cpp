@@ -11,6 +11,7 @@
 #include "bn_timers.h"
 #include "bn_version.h"
 #include "bn_profiler.h"
+#include "bn_frame_timeline.h"
 #include "bn_system_font.h"
 #include "bn_bgs_manager.h"
 #include "bn_hdma_manager.h"
@@ -39,29 +40,19 @@
 #endif
 
 #if BN_CFG_PROFILER_ENABLED && BN_CFG_PROFILER_LOG_ENGINE
-    #if BN_CFG_PROFILER_LOG_ENGINE_DETAILED
-        #define BN_PROFILER_ENGINE_GENERAL_START(id) \
-            do \
-            { \
-            } while(false)
+    #define BN_PROFILER_ENGINE_GENERAL_START(id) \
+        BN_PROFILER_START(id)
 
-        #define BN_PROFILER_ENGINE_GENERAL_STOP() \
-            do \
-            { \
-            } while(false)
+    #define BN_PROFILER_ENGINE_GENERAL_STOP() \
+        BN_PROFILER_STOP()
 
+    #if BN_CFG_PROFILER_LOG_ENGINE_DETAILED
         #define BN_PROFILER_ENGINE_DETAILED_START(id) \
             BN_PROFILER_START(id)
 
         #define BN_PROFILER_ENGINE_DETAILED_STOP() \
             BN_PROFILER_STOP()
     #else
-        #define BN_PROFILER_ENGINE_GENERAL_START(id) \
-            BN_PROFILER_START(id)
-
-        #define BN_PROFILER_ENGINE_GENERAL_STOP() \
-            BN_PROFILER_STOP()
-
         #define BN_PROFILER_ENGINE_DETAILED_START(id) \
             do \
             { \
@@ -94,6 +85,17 @@
         } while(false)
 #endif
 
+#if BN_CFG_FRAME_TIMELINE_ENABLED
+    #define BN_FRAME_TIMELINE_PHASE_END(phase_id) \
+        _bn::frame_timeline::set_phase_end_ticks( \
+            frame_timeline::phase::phase_id, data.cpu_usage_timer.elapsed_ticks())
+#else
+    #define BN_FRAME_TIMELINE_PHASE_END(phase_id) \
+        do \
+        { \
+        } while(false)
+#endif
+
 namespace bn::core
 {
 
@@ -179,34 +181,42 @@ namespace
         BN_PROFILER_ENGINE_DETAILED_START("eng_cameras_update");
         cameras_manager::update();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(CAMERAS_UPDATE);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_sprites_update");
         sprites_manager::update();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(SPRITES_UPDATE);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_spr_tiles_update");
         sprite_tiles_manager::update();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(SPRITE_TILES_UPDATE);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_bgs_update");
         bgs_manager::update();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(BGS_UPDATE);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_bg_blocks_update");
         bg_blocks_manager::update();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(BG_BLOCKS_UPDATE);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_palettes_update");
         palettes_manager::update();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(PALETTES_UPDATE);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_display_update");
         display_manager::update();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(DISPLAY_UPDATE);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_hblank_fx_update");
         hblank_effects_manager::update();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(HBLANK_EFFECTS_UPDATE);
 
         bool use_dma = ! link_manager::active();
 
@@ -223,48 +233,60 @@ namespace
         BN_PROFILER_ENGINE_DETAILED_START("eng_audio_commands");
         audio_manager::execute_commands();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(AUDIO_COMMANDS);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_display_commit");
         display_manager::commit();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(DISPLAY_COMMIT);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_sprites_commit");
         sprites_manager::commit(use_dma);
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(SPRITES_COMMIT);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_bgs_commit");
         bgs_manager::commit(use_dma);
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(BGS_COMMIT);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_palettes_commit");
         palettes_manager::commit(use_dma);
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(PALETTES_COMMIT);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_spr_tiles_unc_commit");
         sprite_tiles_manager::commit_uncompressed(use_dma);
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(SPRITE_TILES_UNCOMPRESSED_COMMIT);
+
+        // Big maps rows can be copied with the low priority DMA channel, so they must be committed before HDMA starts:
+        BN_PROFILER_ENGINE_DETAILED_START("eng_big_maps_commit");
+        bgs_manager::commit_big_maps(use_dma);
+        BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(BIG_MAPS_COMMIT);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_hdma_update");
         hdma_manager::update();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(HDMA_UPDATE);
 
         hdma_manager::commit(use_dma);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_hblank_fx_commit");
         hblank_effects_manager::commit();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(HBLANK_EFFECTS_COMMIT);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_spr_tiles_cmp_commit");
         sprite_tiles_manager::commit_compressed();
         BN_PROFILER_ENGINE_DETAILED_STOP();
-
-        BN_PROFILER_ENGINE_DETAILED_START("eng_big_maps_commit");
-        bgs_manager::commit_big_maps();
-        BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(SPRITE_TILES_COMPRESSED_COMMIT);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_bg_blocks_commit");
         bg_blocks_manager::commit();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(BG_BLOCKS_COMMIT);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_vblank_callback");
         if(vblank_callback_type vblank_callback = data.vblank_callback)
@@ -272,19 +294,27 @@ namespace
             vblank_callback();
         }
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(VBLANK_CALLBACK);
 
         result.vblank_usage_ticks = data.cpu_usage_timer.elapsed_ticks();
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_audio_commit");
         audio_manager::commit();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(AUDIO_COMMIT);
 
         BN_PROFILER_ENGINE_DETAILED_START("eng_gpio_commit");
         gpio_manager::commit();
         BN_PROFILER_ENGINE_DETAILED_STOP();
+        BN_FRAME_TIMELINE_PHASE_END(GPIO_COMMIT);
 
         BN_PROFILER_ENGINE_GENERAL_STOP();
 
+        #if BN_CFG_FRAME_TIMELINE_ENABLED
+            _bn::frame_timeline::commit_frame(result.cpu_usage_ticks, result.vblank_usage_ticks,
+                                              result.missed_frames);
+        #endif
+
         return result;
     }
 }
@@ -300,6 +330,10 @@ void init(const string_view& keypad_commands)
     hw::irq::init();
     hw::irq::set_isr(hw::irq::id::HBLANK, hw::hblank_effects::_intr);
 
+    #if BN_CFG_HBES_SPARSE_MAX_LINES
+        hw::irq::set_isr(hw::irq::id::VCOUNT, hw::hblank_effects::_vcount_intr);
+    #endif
+
     // Init audio system:
     audio_manager::init();
 
@@ -381,6 +415,10 @@ void update()
     BN_PROFILER_ENGINE_DETAILED_START("eng_keypad");
     keypad_manager::update();
     BN_PROFILER_ENGINE_DETAILED_STOP();
+
+    #if BN_CFG_PROFILER_ENABLED
+        _bn::profiler::update_frame();
+    #endif
 }
 
 void on_vblank()
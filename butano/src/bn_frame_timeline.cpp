@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_frame_timeline.h"
+
+#if BN_CFG_FRAME_TIMELINE_ENABLED
+    #include "bn_log.h"
+    #include "bn_deque.h"
+    #include "bn_limits.h"
+    #include "bn_string.h"
+
+    namespace bn::frame_timeline
+    {
+        namespace
+        {
+            static_assert(BN_CFG_FRAME_TIMELINE_MAX_FRAMES > 0);
+            static_assert(power_of_two(BN_CFG_FRAME_TIMELINE_MAX_FRAMES));
+
+            constexpr const char* phase_names[] = {
+                "cameras_update",
+                "sprites_update",
+                "spr_tiles_update",
+                "bgs_update",
+                "bg_blocks_update",
+                "palettes_update",
+                "display_update",
+                "hblank_fx_update",
+                "audio_commands",
+                "display_commit",
+                "sprites_commit",
+                "bgs_commit",
+                "palettes_commit",
+                "spr_tiles_unc_commit",
+                "big_maps_commit",
+                "hdma_update",
+                "hblank_fx_commit",
+                "spr_tiles_cmp_commit",
+                "bg_blocks_commit",
+                "vblank_callback",
+                "audio_commit",
+                "gpio_commit",
+            };
+
+            static_assert(sizeof(phase_names) / sizeof(*phase_names) == phases_count());
+
+            class static_data
+            {
+
+            public:
+                deque<frame, BN_CFG_FRAME_TIMELINE_MAX_FRAMES> frames;
+                frame current_frame;
+            };
+
+            BN_DATA_EWRAM static_data data;
+
+            [[nodiscard]] uint16_t clamp_ticks(int ticks)
+            {
+                return uint16_t(clamp(ticks, 0, int(numeric_limits<uint16_t>::max())));
+            }
+
+            void append_hex(unsigned value, int bytes, ostringstream& stream)
+            {
+                constexpr char digits[] = "0123456789abcdef";
+
+                for(int index = 0; index < bytes; ++index)
+                {
+                    unsigned byte = value & 0xFF;
+                    stream.append(digits[byte >> 4]);
+                    stream.append(digits[byte & 0xF]);
+                    value >>= 8;
+                }
+            }
+        }
+
+        const char* phase_name(phase phase)
+        {
+            return phase_names[int(phase)];
+        }
+
+        int frames_count()
+        {
+            return data.frames.size();
+        }
+
+        const frame& frame_at(int index)
+        {
+            BN_ASSERT(index >= 0 && index < data.frames.size(), "Invalid index: ", index, " - ", data.frames.size());
+
+            return data.frames[index];
+        }
+
+        void clear()
+        {
+            data.frames.clear();
+            data.current_frame = frame();
+        }
+
+        void log_csv()
+        {
+            for(int index = 0; index < phases_count(); ++index)
+            {
+                BN_LOG("frame_timeline phase ", index, ": ", phase_names[index]);
+            }
+
+            BN_LOG("frame_timeline_csv_begin");
+
+            string<BN_CFG_LOG_MAX_SIZE> header("frame,missed_frames,cpu_usage_ticks,vblank_usage_ticks");
+            ostringstream header_stream(header);
+
+            for(int index = 0; index < phases_count(); ++index)
+            {
+                header_stream << ",p" << index;
+            }
+
+            BN_LOG(header);
+
+            for(const frame& frame : data.frames)
+            {
+                string<BN_CFG_LOG_MAX_SIZE> row;
+                ostringstream row_stream(row);
+                row_stream << frame.number() << ',' << frame.missed_frames() << ',' << frame.cpu_usage_ticks() << ','
+                           << frame.vblank_usage_ticks();
+
+                for(int index = 0; index < phases_count(); ++index)
+                {
+                    row_stream << ',' << frame.phase_end_ticks(phase(index));
+                }
+
+                BN_LOG(row);
+            }
+
+            BN_LOG("frame_timeline_csv_end");
+        }
+
+        void log_binary()
+        {
+            BN_LOG("frame_timeline_bin_begin ", phases_count());
+
+            for(const frame& frame : data.frames)
+            {
+                string<BN_CFG_LOG_MAX_SIZE> row;
+                ostringstream row_stream(row);
+                append_hex(frame.number(), 4, row_stream);
+
+                for(int index = 0; index < phases_count(); ++index)
+                {
+                    append_hex(unsigned(frame.phase_end_ticks(phase(index))), 2, row_stream);
+                }
+
+                append_hex(unsigned(frame.cpu_usage_ticks()), 2, row_stream);
+                append_hex(unsigned(frame.vblank_usage_ticks()), 2, row_stream);
+                append_hex(unsigned(frame.missed_frames()), 2, row_stream);
+                BN_LOG(row);
+            }
+
+            BN_LOG("frame_timeline_bin_end");
+        }
+    }
+
+    namespace _bn::frame_timeline
+    {
+        void set_phase_end_ticks(bn::frame_timeline::phase phase, int ticks)
+        {
+            bn::frame_timeline::data.current_frame._phase_end_ticks[int(phase)] =
+                    bn::frame_timeline::clamp_ticks(ticks);
+        }
+
+        void commit_frame(int cpu_usage_ticks, int vblank_usage_ticks, int missed_frames)
+        {
+            auto& data = bn::frame_timeline::data;
+            bn::frame_timeline::frame& current_frame = data.current_frame;
+            current_frame._cpu_usage_ticks = bn::frame_timeline::clamp_ticks(cpu_usage_ticks);
+            current_frame._vblank_usage_ticks = bn::frame_timeline::clamp_ticks(vblank_usage_ticks);
+            current_frame._missed_frames = bn::frame_timeline::clamp_ticks(missed_frames);
+
+            if(data.frames.full())
+            {
+                data.frames.pop_front();
+            }
+
+            data.frames.push_back(current_frame);
+            ++current_frame._number;
+        }
+    }
+#endif
@@ -28,6 +28,11 @@ void hbe_ptr::set_visible(bool visible)
     hblank_effects_manager::set_visible(_id, visible);
 }
 
+bool hbe_ptr::hdma() const
+{
+    return hblank_effects_manager::hdma(_id);
+}
+
 hbe_ptr::hbe_ptr(const hbe_ptr& other) :
     hbe_ptr(other._id)
 {
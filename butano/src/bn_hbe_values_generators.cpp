@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_hbe_values_generators.h"
+
+#include "bn_math.h"
+#include "bn_algorithm.h"
+
+namespace bn
+{
+
+namespace
+{
+    constexpr int q30_shift = 30;
+    constexpr int q30_one = 1 << q30_shift;
+
+    [[nodiscard]] int _q30_multiply(int a, int b)
+    {
+        return int((int64_t(a) * b) >> q30_shift);
+    }
+
+    // Calculates sine and cosine in Q30 with a Taylor series (more accurate than sin LUTs,
+    // so forward differencing doesn't drift):
+    void _q30_degrees_sin_and_cos(fixed degrees_angle, int& sin, int& cos)
+    {
+        int degrees_data = degrees_angle.data() % fixed(360).data();
+
+        if(degrees_data > fixed(180).data())
+        {
+            degrees_data -= fixed(360).data();
+        }
+        else if(degrees_data < -fixed(180).data())
+        {
+            degrees_data += fixed(360).data();
+        }
+
+        // Halve the angle until the series converges fast enough:
+        int halvings = 0;
+
+        while(degrees_data > fixed(22.5).data() || degrees_data < -fixed(22.5).data())
+        {
+            degrees_data /= 2;
+            ++halvings;
+        }
+
+        constexpr int64_t q30_radians_per_degree = 18740330; // (pi / 180) * 2^30
+        int x = int((degrees_data * q30_radians_per_degree) >> fixed::precision());
+        int x2 = _q30_multiply(x, x);
+
+        int sin_value = q30_one - (x2 / 42);
+        sin_value = q30_one - (_q30_multiply(x2, sin_value) / 20);
+        sin_value = q30_one - (_q30_multiply(x2, sin_value) / 6);
+        sin_value = _q30_multiply(x, sin_value);
+
+        int cos_value = q30_one - (x2 / 56);
+        cos_value = q30_one - (_q30_multiply(x2, cos_value) / 30);
+        cos_value = q30_one - (_q30_multiply(x2, cos_value) / 12);
+        cos_value = q30_one - (_q30_multiply(x2, cos_value) / 2);
+
+        for(int index = 0; index < halvings; ++index)
+        {
+            int new_sin_value = 2 * _q30_multiply(sin_value, cos_value);
+            cos_value = _q30_multiply(cos_value, cos_value) - _q30_multiply(sin_value, sin_value);
+            sin_value = new_sin_value;
+        }
+
+        sin = sin_value;
+        cos = cos_value;
+    }
+
+    void _generate_linear(fixed first_value, fixed last_value, int lines, fixed* values)
+    {
+        if(lines == 1)
+        {
+            values[0] = first_value;
+            return;
+        }
+
+        int64_t value = int64_t(first_value.data()) << 16;
+        int64_t delta = (int64_t(last_value.data() - first_value.data()) << 16) / (lines - 1);
+
+        for(int index = 0, limit = lines - 1; index < limit; ++index)
+        {
+            values[index] = fixed::from_data(int(value >> 16));
+            value += delta;
+        }
+
+        values[lines - 1] = last_value;
+    }
+}
+
+sine_wave_hbe_values::sine_wave_hbe_values(fixed amplitude, fixed degrees_step, fixed degrees_phase) :
+    _amplitude(amplitude),
+    _degrees_step(degrees_step),
+    _degrees_phase(degrees_phase)
+{
+    _generate();
+}
+
+void sine_wave_hbe_values::set_amplitude(fixed amplitude)
+{
+    if(amplitude != _amplitude)
+    {
+        _amplitude = amplitude;
+        _regenerate = true;
+    }
+}
+
+void sine_wave_hbe_values::set_degrees_step(fixed degrees_step)
+{
+    if(degrees_step != _degrees_step)
+    {
+        _degrees_step = degrees_step;
+        _regenerate = true;
+    }
+}
+
+void sine_wave_hbe_values::set_degrees_phase(fixed degrees_phase)
+{
+    if(degrees_phase != _degrees_phase)
+    {
+        _degrees_phase = degrees_phase;
+        _regenerate = true;
+    }
+}
+
+void sine_wave_hbe_values::_generate()
+{
+    int step_sin;
+    int step_cos;
+    _q30_degrees_sin_and_cos(_degrees_step, step_sin, step_cos);
+
+    int phase_sin;
+    int phase_cos;
+    _q30_degrees_sin_and_cos(_degrees_phase, phase_sin, phase_cos);
+
+    // sin(a + (n + 1) * b) = 2 * cos(b) * sin(a + n * b) - sin(a + (n - 1) * b):
+    int64_t step_cos_2 = int64_t(step_cos) * 2;
+    int previous_sin = phase_sin;
+    int current_sin = _q30_multiply(phase_sin, step_cos) + _q30_multiply(phase_cos, step_sin);
+    int64_t amplitude_data = _amplitude.data();
+    constexpr int64_t round = int64_t(1) << (q30_shift - 1);
+    _values[0] = fixed::from_data(int(((amplitude_data * previous_sin) + round) >> q30_shift));
+
+    for(int index = 1; index < display::height(); ++index)
+    {
+        _values[index] = fixed::from_data(int(((amplitude_data * current_sin) + round) >> q30_shift));
+
+        int next_sin = int(((step_cos_2 * current_sin) >> q30_shift) - previous_sin);
+        previous_sin = current_sin;
+        current_sin = next_sin;
+    }
+
+    _regenerate = false;
+}
+
+linear_gradient_hbe_values::linear_gradient_hbe_values(fixed first_value, fixed last_value) :
+    _first_value(first_value),
+    _last_value(last_value)
+{
+    _generate();
+}
+
+void linear_gradient_hbe_values::set_first_value(fixed first_value)
+{
+    if(first_value != _first_value)
+    {
+        _first_value = first_value;
+        _regenerate = true;
+    }
+}
+
+void linear_gradient_hbe_values::set_last_value(fixed last_value)
+{
+    if(last_value != _last_value)
+    {
+        _last_value = last_value;
+        _regenerate = true;
+    }
+}
+
+void linear_gradient_hbe_values::_generate()
+{
+    _generate_linear(_first_value, _last_value, display::height(), _values);
+    _regenerate = false;
+}
+
+perspective_hbe_values::perspective_hbe_values(fixed scale, int horizon_line, fixed horizon_value) :
+    _scale(scale),
+    _horizon_value(horizon_value),
+    _horizon_line(horizon_line)
+{
+    BN_ASSERT(horizon_line >= display::height() - reciprocal_lut_size, "Invalid horizon line: ", horizon_line);
+
+    _generate();
+}
+
+void perspective_hbe_values::set_scale(fixed scale)
+{
+    if(scale != _scale)
+    {
+        _scale = scale;
+        _regenerate = true;
+    }
+}
+
+void perspective_hbe_values::set_horizon_line(int horizon_line)
+{
+    BN_ASSERT(horizon_line >= display::height() - reciprocal_lut_size, "Invalid horizon line: ", horizon_line);
+
+    if(horizon_line != _horizon_line)
+    {
+        _horizon_line = horizon_line;
+        _regenerate = true;
+    }
+}
+
+void perspective_hbe_values::set_horizon_value(fixed horizon_value)
+{
+    if(horizon_value != _horizon_value)
+    {
+        _horizon_value = horizon_value;
+        _regenerate = true;
+    }
+}
+
+void perspective_hbe_values::_generate()
+{
+    int horizon_line = _horizon_line;
+    int first_line = min(max(horizon_line + 1, 0), display::height());
+    fixed horizon_value = _horizon_value;
+
+    for(int index = 0; index < first_line; ++index)
+    {
+        _values[index] = horizon_value;
+    }
+
+    int64_t scale_data = _scale.data();
+
+    for(int index = first_line; index < display::height(); ++index)
+    {
+        fixed_t<20> reciprocal = lut_reciprocal(index - horizon_line);
+        _values[index] = fixed::from_data(int((scale_data * reciprocal.data()) >> 20));
+    }
+
+    _regenerate = false;
+}
+
+keyframes_hbe_values::keyframes_hbe_values(const span<const hbe_keyframe>& keyframes_ref) :
+    _keyframes_ref(keyframes_ref)
+{
+    BN_ASSERT(! keyframes_ref.empty(), "There's no keyframes");
+
+    _generate();
+}
+
+void keyframes_hbe_values::set_keyframes_ref(const span<const hbe_keyframe>& keyframes_ref)
+{
+    BN_ASSERT(! keyframes_ref.empty(), "There's no keyframes");
+
+    _keyframes_ref = keyframes_ref;
+    _regenerate = true;
+}
+
+void keyframes_hbe_values::_generate()
+{
+    const hbe_keyframe* keyframes = _keyframes_ref.data();
+    int keyframes_count = _keyframes_ref.size();
+    const hbe_keyframe& first_keyframe = keyframes[0];
+
+    for(int index = 0, limit = first_keyframe.line(); index < limit; ++index)
+    {
+        _values[index] = first_keyframe.value();
+    }
+
+    for(int keyframe_index = 1; keyframe_index < keyframes_count; ++keyframe_index)
+    {
+        const hbe_keyframe& previous_keyframe = keyframes[keyframe_index - 1];
+        const hbe_keyframe& keyframe = keyframes[keyframe_index];
+        int previous_line = previous_keyframe.line();
+        int lines = keyframe.line() - previous_line + 1;
+        BN_ASSERT(lines > 1, "Keyframes are not sorted by line: ", keyframe_index);
+
+        _generate_linear(previous_keyframe.value(), keyframe.value(), lines, _values + previous_line);
+    }
+
+    const hbe_keyframe& last_keyframe = keyframes[keyframes_count - 1];
+
+    for(int index = last_keyframe.line(); index < display::height(); ++index)
+    {
+        _values[index] = last_keyframe.value();
+    }
+
+    _regenerate = false;
+}
+
+}
@@ -6,6 +6,7 @@
 #include "bn_hblank_effects_manager.h"
 
 #include "bn_vector.h"
+#include "bn_hdma_manager.h"
 #include "../hw/include/bn_hw_hblank_effects.h"
 
 #include "bn_bg_palette_color_hbe_handler.h"
@@ -78,8 +79,11 @@ namespace bn::hblank_effects_manager
 namespace
 {
     constexpr int max_items = BN_CFG_HBES_MAX_ITEMS;
+    constexpr int max_hdma_items = BN_CFG_HBES_MAX_HDMA_ITEMS;
+    constexpr int max_irq_items = 8;
 
-    static_assert(max_items > 0 && max_items <= 8);
+    static_assert(max_hdma_items >= 0 && max_hdma_items <= 2);
+    static_assert(max_items > 0 && max_items <= max_irq_items + max_hdma_items);
 
     constexpr int max_uint32_output_values = hw::hblank_effects::max_uint32_entries();
     constexpr int max_uint16_output_values = max(max_items - max_uint32_output_values, 1);
@@ -255,6 +259,7 @@ namespace
         bool update: 1 = false;
         bool on_screen: 1 = false;
         bool output_values_written: 1 = false;
+        bool hdma: 1 = false;
 
         void setup_target()
         {
@@ -598,6 +603,32 @@ namespace
             }
         }
 
+        void start_hdma(bool high_priority) const
+        {
+            const uint16_t* src;
+            int elements;
+
+            if(uint16_output_values)
+            {
+                src = uint16_output_values->a_active ? uint16_output_values->a : uint16_output_values->b;
+                elements = 1;
+            }
+            else
+            {
+                src = uint32_output_values->a_active ? uint32_output_values->a : uint32_output_values->b;
+                elements = _is_uint32(handler) ? 2 : 1;
+            }
+
+            if(high_priority)
+            {
+                hdma_manager::high_priority_hbe_start(*src, elements, *output_register);
+            }
+            else
+            {
+                hdma_manager::low_priority_hbe_start(*src, elements, *output_register);
+            }
+        }
+
         void show()
         {
             switch(handler)
@@ -1033,6 +1064,9 @@ namespace
         bool update = false;
         bool commit = false;
         bool enabled = false;
+        bool sparse = false;
+        uint8_t free_hdma_channels = 0;
+        uint8_t used_hdma_channels = 0;
     };
 
     class static_internal_data
@@ -1046,6 +1080,88 @@ namespace
     BN_DATA_EWRAM static_external_data external_data;
     static_internal_data internal_data;
 
+    #if BN_CFG_HBES_SPARSE_MAX_LINES
+        [[nodiscard]] bool _line_changed(const hw_entries& entries, int line)
+        {
+            for(int index = 0, limit = entries.uint16_entries_count; index < limit; ++index)
+            {
+                const uint16_t* src = entries.uint16_entries[index].src;
+
+                if(src[line] != src[line - 1])
+                {
+                    return true;
+                }
+            }
+
+            for(int index = 0, limit = entries.uint32_entries_count; index < limit; ++index)
+            {
+                const uint32_t* src = entries.uint32_entries[index].src;
+
+                if(src[line] != src[line - 1])
+                {
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        void _setup_sparse(hw_entries& entries)
+        {
+            // Values are always written in the first line, since the previous frame last line values are still set:
+            int changed_lines = 0;
+            int next_change_line = 0;
+            entries.sparse = false;
+
+            for(int line = display::height() - 1; line >= 0; --line)
+            {
+                entries.next_change_lines[line] = uint8_t(next_change_line);
+
+                if(! line || _line_changed(entries, line))
+                {
+                    ++changed_lines;
+
+                    if(changed_lines > BN_CFG_HBES_SPARSE_MAX_LINES)
+                    {
+                        return;
+                    }
+
+                    next_change_line = line;
+                }
+            }
+
+            entries.sparse = true;
+        }
+    #endif
+
+    #if BN_CFG_HBES_MAX_HDMA_ITEMS
+        // Bit 0: low priority channel, bit 1: high priority channel.
+        [[nodiscard]] unsigned _free_hdma_channels()
+        {
+            unsigned result = hdma_manager::low_priority_running() ? 0 : 1;
+
+            if(max_hdma_items > 1 && ! hdma_manager::high_priority_running())
+            {
+                result |= 2;
+            }
+
+            return result;
+        }
+
+        void _stop_hdma_channels(unsigned channels)
+        {
+            if(channels & 1)
+            {
+                hdma_manager::low_priority_hbe_stop();
+            }
+
+            if(channels & 2)
+            {
+                hdma_manager::high_priority_hbe_stop();
+            }
+        }
+    #endif
+
     void _update_visible_item_index(int item_index)
     {
         static_external_data& data = external_data;
@@ -1133,6 +1249,7 @@ namespace
         new_item.update = true;
         new_item.on_screen = false;
         new_item.output_values_written = false;
+        new_item.hdma = false;
         new_item.setup_target();
 
         _update_visible_item_index(item_index);
@@ -1176,7 +1293,7 @@ void enable()
 {
     if(external_data.enabled)
     {
-        hw::hblank_effects::enable();
+        hw::hblank_effects::enable(external_data.sparse);
     }
 }
 
@@ -1280,6 +1397,12 @@ void reload_values_ref(int id)
     return item.visible;
 }
 
+bool hdma(int id)
+{
+    const item_type& item = external_data.items[id];
+    return item.hdma;
+}
+
 void set_visible(int id, bool visible)
 {
     item_type& item = external_data.items[id];
@@ -1287,6 +1410,7 @@ void set_visible(int id, bool visible)
     if(visible != item.visible)
     {
         item.visible = visible;
+        item.hdma = false;
         external_data.update = true;
 
         if(visible)
@@ -1305,6 +1429,17 @@ void update()
     bool update = external_data.update;
     external_data.update = false;
 
+    #if BN_CFG_HBES_MAX_HDMA_ITEMS
+        // HDMA channels used by bn::hdma can't be used by H-Blank effects:
+        unsigned free_hdma_channels = _free_hdma_channels();
+
+        if(free_hdma_channels != external_data.free_hdma_channels)
+        {
+            external_data.free_hdma_channels = uint8_t(free_hdma_channels);
+            update = true;
+        }
+    #endif
+
     int first_visible_item_index = external_data.first_visible_item_index;
     int last_visible_item_index = external_data.last_visible_item_index;
 
@@ -1365,17 +1500,55 @@ void update()
         entries->uint16_entries_count = 0;
         entries->uint32_entries_count = 0;
 
+        #if BN_CFG_HBES_MAX_HDMA_ITEMS
+            unsigned hdma_channels = free_hdma_channels;
+        #endif
+
         for(int item_index = first_visible_item_index; item_index <= last_visible_item_index; ++item_index)
         {
-            const item_type& item = external_data.items[item_index];
+            item_type& item = external_data.items[item_index];
+            item.hdma = false;
 
             if(item.visible && item.on_screen)
             {
+                #if BN_CFG_HBES_MAX_HDMA_ITEMS
+                    if(hdma_channels)
+                    {
+                        item.start_hdma(! (hdma_channels & 1));
+                        item.hdma = true;
+                        hdma_channels &= hdma_channels - 1;
+                        continue;
+                    }
+                #endif
+
+                if constexpr(max_items > max_irq_items)
+                {
+                    // If bn::hdma is using the HDMA channels and the H-Blank interrupt is full,
+                    // the remaining H-Blank effects are not shown until a channel is released:
+                    if(entries->uint16_entries_count + entries->uint32_entries_count == max_irq_items)
+                    {
+                        continue;
+                    }
+                }
+
                 item.setup_entry(*entries);
                 visible_entries = true;
             }
         }
 
+        #if BN_CFG_HBES_MAX_HDMA_ITEMS
+            unsigned used_hdma_channels = free_hdma_channels & ~hdma_channels;
+            _stop_hdma_channels(external_data.used_hdma_channels & ~used_hdma_channels);
+            external_data.used_hdma_channels = uint8_t(used_hdma_channels);
+        #endif
+
+        #if BN_CFG_HBES_SPARSE_MAX_LINES
+            if(visible_entries)
+            {
+                _setup_sparse(*entries);
+            }
+        #endif
+
         external_data.visible_entries = visible_entries;
         external_data.commit = true;
     }
@@ -1392,10 +1565,25 @@ void commit()
             hw_entries* entries = external_data.entries_a_active ? &internal_data.entries_a : &internal_data.entries_b;
             hw::hblank_effects::commit_entries(*entries);
 
+            #if BN_CFG_HBES_SPARSE_MAX_LINES
+                bool sparse = entries->sparse;
+
+                if(sparse != external_data.sparse)
+                {
+                    external_data.sparse = sparse;
+
+                    if(external_data.enabled)
+                    {
+                        external_data.enabled = false;
+                        hw::hblank_effects::disable();
+                    }
+                }
+            #endif
+
             if(! external_data.enabled)
             {
                 external_data.enabled = true;
-                hw::hblank_effects::enable();
+                hw::hblank_effects::enable(external_data.sparse);
             }
         }
         else
@@ -84,6 +84,8 @@ namespace bn::hblank_effects_manager
 
     void set_visible(int id, bool visible);
 
+    [[nodiscard]] bool hdma(int id);
+
     void update();
 
     void commit();
@@ -6,10 +6,12 @@
 #include "bn_hdma_manager.h"
 
 #include "bn_display.h"
+#include "bn_config_hdma.h"
 #include "../hw/include/bn_hw_dma.h"
 #include "../hw/include/bn_hw_memory.h"
 
 #include "bn_hdma.cpp.h"
+#include "bn_hdma_stream.cpp.h"
 
 namespace bn::hdma_manager
 {
@@ -23,6 +25,8 @@ namespace
         const uint16_t* source_ptr = nullptr;
         uint16_t* destination_ptr = nullptr;
         int elements = 0;
+        bool words = false;
+        bool indexed_by_line = false;
     };
 
     class entry
@@ -36,7 +40,30 @@ namespace
 
         [[nodiscard]] bool running() const
         {
-            return _next_state().elements;
+            return _reserved || _next_state().elements;
+        }
+
+        [[nodiscard]] bool reserved() const
+        {
+            return _reserved;
+        }
+
+        void reserve()
+        {
+            _reserved = true;
+        }
+
+        void release()
+        {
+            // Referenced tables can be destroyed after releasing the channel, so it is stopped now:
+            _reserved = false;
+            force_stop();
+        }
+
+        [[nodiscard]] const uint16_t* current_source() const
+        {
+            const state& current_state = _current_state();
+            return current_state.elements ? current_state.source_ptr : nullptr;
         }
 
         void disable()
@@ -46,10 +73,25 @@ namespace
 
         void start(const uint16_t& source_ref, int elements, uint16_t& destination_ref)
         {
+            BN_ASSERT(! _reserved, "HDMA channel is used by an HDMA stream");
+
             state& next_state = _next_state();
             next_state.source_ptr = &source_ref;
             next_state.destination_ptr = &destination_ref;
             next_state.elements = elements;
+            next_state.words = false;
+            next_state.indexed_by_line = false;
+            _updated = true;
+        }
+
+        void stream_start(const void* source_ptr, int elements, bool words, void* destination_ptr)
+        {
+            state& next_state = _next_state();
+            next_state.source_ptr = static_cast<const uint16_t*>(source_ptr);
+            next_state.destination_ptr = static_cast<uint16_t*>(destination_ptr);
+            next_state.elements = elements;
+            next_state.words = words;
+            next_state.indexed_by_line = true;
             _updated = true;
         }
 
@@ -60,10 +102,29 @@ namespace
             _updated = true;
         }
 
+        void hbe_start(const uint16_t& source_ref, int elements, uint16_t& destination_ref)
+        {
+            state& next_hbe_state = _next_hbe_state();
+            next_hbe_state.source_ptr = &source_ref;
+            next_hbe_state.destination_ptr = &destination_ref;
+            next_hbe_state.elements = elements;
+            next_hbe_state.indexed_by_line = true;
+            _updated = true;
+        }
+
+        void hbe_stop()
+        {
+            state& next_hbe_state = _next_hbe_state();
+            next_hbe_state.elements = 0;
+            _updated = true;
+        }
+
         void force_stop()
         {
             _states[0].elements = 0;
             _states[1].elements = 0;
+            _hbe_states[0].elements = 0;
+            _hbe_states[1].elements = 0;
             _updated = false;
             disable();
         }
@@ -78,11 +139,13 @@ namespace
                 {
                     _current_state_index = 0;
                     _states[1] = _states[0];
+                    _hbe_states[1] = _hbe_states[0];
                 }
                 else
                 {
                     _current_state_index = 1;
                     _states[0] = _states[1];
+                    _hbe_states[0] = _hbe_states[1];
                 }
             }
         }
@@ -91,35 +154,76 @@ namespace
         {
             const state& current_state = _current_state();
 
-            if(int elements = current_state.elements)
+            if(current_state.elements)
             {
-                const uint16_t* source_ptr = current_state.source_ptr;
-                const uint16_t* initial_copy_source_ptr = source_ptr + ((display::height() - 1) * elements);
-                uint16_t* destination_ptr = current_state.destination_ptr;
+                _commit(current_state, use_dma);
+            }
+            else if(const state& current_hbe_state = _current_hbe_state(); current_hbe_state.elements)
+            {
+                _commit(current_hbe_state, use_dma);
+            }
+            else
+            {
+                hw::dma::stop_hdma(_channel);
+            }
+        }
+
+    private:
+        state _states[2];
+        state _hbe_states[2];
+        int8_t _channel = 0;
+        int8_t _current_state_index = 0;
+        bool _updated = false;
+        bool _reserved = false;
+
+        void _commit(const state& state, bool use_dma)
+        {
+            int elements = state.elements;
+            int half_words = state.words ? elements * 2 : elements;
+            const uint16_t* source_ptr = state.source_ptr;
+            const uint16_t* initial_copy_source_ptr;
+            uint16_t* destination_ptr = state.destination_ptr;
 
+            if(state.indexed_by_line)
+            {
+                // Values are indexed by screen line, so the first line values are copied now
+                // and the next ones are copied in the H-Blank of the previous line:
+                initial_copy_source_ptr = source_ptr;
+                source_ptr += half_words;
+            }
+            else
+            {
+                initial_copy_source_ptr = source_ptr + ((display::height() - 1) * half_words);
+            }
+
+            if(state.words)
+            {
                 if(use_dma)
                 {
-                    hw::dma::copy_half_words(initial_copy_source_ptr, elements, destination_ptr);
+                    hw::dma::copy_words(initial_copy_source_ptr, elements, destination_ptr);
                 }
                 else
                 {
-                    hw::memory::copy_half_words(initial_copy_source_ptr, elements, destination_ptr);
+                    hw::memory::copy_words(initial_copy_source_ptr, elements, destination_ptr);
                 }
 
-                hw::dma::start_hdma(_channel, source_ptr, elements, destination_ptr);
+                hw::dma::start_hdma_words(_channel, source_ptr, elements, destination_ptr);
             }
             else
             {
-                hw::dma::stop_hdma(_channel);
+                if(use_dma)
+                {
+                    hw::dma::copy_half_words(initial_copy_source_ptr, elements, destination_ptr);
+                }
+                else
+                {
+                    hw::memory::copy_half_words(initial_copy_source_ptr, elements, destination_ptr);
+                }
+
+                hw::dma::start_hdma(_channel, source_ptr, elements, destination_ptr);
             }
         }
 
-    private:
-        state _states[2];
-        int8_t _channel = 0;
-        int8_t _current_state_index = 0;
-        bool _updated = false;
-
         [[nodiscard]] const state& _current_state() const
         {
             return _states[_current_state_index];
@@ -139,17 +243,51 @@ namespace
         {
             return _states[(_current_state_index + 1) % 2];
         }
+
+        [[nodiscard]] const state& _current_hbe_state() const
+        {
+            return _hbe_states[_current_state_index];
+        }
+
+        [[nodiscard]] state& _next_hbe_state()
+        {
+            return _hbe_states[(_current_state_index + 1) % 2];
+        }
     };
 
+    static_assert(BN_CFG_HDMA_MAX_CHANNELS == 2 || BN_CFG_HDMA_MAX_CHANNELS == 3);
+
     class static_data
     {
 
     public:
-        entry low_priority_entry = entry(hw::dma::low_priority_channel());
-        entry high_priority_entry = entry(hw::dma::high_priority_channel());
+        entry entries[BN_CFG_HDMA_MAX_CHANNELS] = {
+            entry(hw::dma::low_priority_channel()),
+            entry(hw::dma::high_priority_channel()),
+            #if BN_CFG_HDMA_MAX_CHANNELS > 2
+                entry(hw::dma::medium_priority_channel()),
+            #endif
+        };
     };
 
+    constexpr int low_priority_index = 0;
+    constexpr int high_priority_index = 1;
+
+    #if BN_CFG_HDMA_MAX_CHANNELS > 2
+        constexpr int medium_priority_index = 2;
+    #endif
+
     BN_DATA_EWRAM static_data data;
+
+    [[nodiscard]] entry& low_priority_entry()
+    {
+        return data.entries[low_priority_index];
+    }
+
+    [[nodiscard]] entry& high_priority_entry()
+    {
+        return data.entries[high_priority_index];
+    }
 }
 
 void enable()
@@ -159,56 +297,139 @@ void enable()
 
 void disable()
 {
-    data.low_priority_entry.disable();
-    data.high_priority_entry.disable();
+    for(entry& entry : data.entries)
+    {
+        entry.disable();
+    }
 }
 
 void force_stop()
 {
-    data.low_priority_entry.force_stop();
-    data.high_priority_entry.force_stop();
+    for(entry& entry : data.entries)
+    {
+        entry.force_stop();
+    }
 }
 
 bool low_priority_running()
 {
-    return data.low_priority_entry.running();
+    return low_priority_entry().running();
 }
 
 void low_priority_start(const uint16_t& source_ref, int elements, uint16_t& destination_ref)
 {
-    data.low_priority_entry.start(source_ref, elements, destination_ref);
+    low_priority_entry().start(source_ref, elements, destination_ref);
 }
 
 void low_priority_stop()
 {
-    data.low_priority_entry.stop();
+    low_priority_entry().stop();
 }
 
 bool high_priority_running()
 {
-    return data.high_priority_entry.running();
+    return high_priority_entry().running();
 }
 
 void high_priority_start(const uint16_t& source_ref, int elements, uint16_t& destination_ref)
 {
-    data.high_priority_entry.start(source_ref, elements, destination_ref);
+    high_priority_entry().start(source_ref, elements, destination_ref);
 }
 
 void high_priority_stop()
 {
-    data.high_priority_entry.stop();
+    high_priority_entry().stop();
+}
+
+void low_priority_hbe_start(const uint16_t& source_ref, int elements, uint16_t& destination_ref)
+{
+    low_priority_entry().hbe_start(source_ref, elements, destination_ref);
+}
+
+void low_priority_hbe_stop()
+{
+    low_priority_entry().hbe_stop();
+}
+
+void high_priority_hbe_start(const uint16_t& source_ref, int elements, uint16_t& destination_ref)
+{
+    high_priority_entry().hbe_start(source_ref, elements, destination_ref);
+}
+
+void high_priority_hbe_stop()
+{
+    high_priority_entry().hbe_stop();
+}
+
+int stream_reserve()
+{
+    // Channels which don't interfere with audio nor with bn::hdma are reserved first:
+    constexpr int reserve_order[] = {
+        #if BN_CFG_HDMA_MAX_CHANNELS > 2
+            medium_priority_index,
+        #endif
+        low_priority_index,
+        high_priority_index
+    };
+
+    for(int channel_index : reserve_order)
+    {
+        entry& entry = data.entries[channel_index];
+
+        if(! entry.running())
+        {
+            entry.reserve();
+            return channel_index;
+        }
+    }
+
+    BN_ERROR("There's no HDMA channels available");
+    return -1;
+}
+
+void stream_release(int channel_index)
+{
+    data.entries[channel_index].release();
+}
+
+bool stream_high_priority(int channel_index)
+{
+    return channel_index == high_priority_index;
+}
+
+void stream_start(int channel_index, const void* source_ptr, int elements, bool words, void* destination_ptr)
+{
+    data.entries[channel_index].stream_start(source_ptr, elements, words, destination_ptr);
+}
+
+void stream_stop(int channel_index)
+{
+    data.entries[channel_index].stop();
+}
+
+const void* stream_current_source(int channel_index)
+{
+    return data.entries[channel_index].current_source();
 }
 
 void update()
 {
-    data.high_priority_entry.update();
-    data.low_priority_entry.update();
+    for(entry& entry : data.entries)
+    {
+        entry.update();
+    }
 }
 
 void commit(bool use_dma)
 {
-    data.high_priority_entry.commit(use_dma);
-    data.low_priority_entry.commit(use_dma);
+    // Higher priority channels are committed first:
+    high_priority_entry().commit(use_dma);
+
+    #if BN_CFG_HDMA_MAX_CHANNELS > 2
+        data.entries[medium_priority_index].commit(use_dma);
+    #endif
+
+    low_priority_entry().commit(use_dma);
 }
 
 }
@@ -28,6 +28,26 @@ namespace bn::hdma_manager
 
     void high_priority_stop();
 
+    void low_priority_hbe_start(const uint16_t& source_ref, int elements, uint16_t& destination_ref);
+
+    void low_priority_hbe_stop();
+
+    void high_priority_hbe_start(const uint16_t& source_ref, int elements, uint16_t& destination_ref);
+
+    void high_priority_hbe_stop();
+
+    [[nodiscard]] int stream_reserve();
+
+    void stream_release(int channel_index);
+
+    [[nodiscard]] bool stream_high_priority(int channel_index);
+
+    void stream_start(int channel_index, const void* source_ptr, int elements, bool words, void* destination_ptr);
+
+    void stream_stop(int channel_index);
+
+    [[nodiscard]] const void* stream_current_source(int channel_index);
+
     void update();
 
     void commit(bool use_dma);
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_hdma_stream.h"
+
+#include "bn_assert.h"
+#include "bn_hdma_manager.h"
+
+namespace bn
+{
+
+ihdma_stream::ihdma_stream(void* tables_ptr, int elements, int tables_count, bool words, void* destination_ptr) :
+    _tables_ptr(static_cast<uint8_t*>(tables_ptr)),
+    _destination_ptr(destination_ptr),
+    _elements(elements),
+    _tables_count(int8_t(tables_count)),
+    _channel_index(int8_t(hdma_manager::stream_reserve())),
+    _words(words)
+{
+}
+
+ihdma_stream::~ihdma_stream()
+{
+    hdma_manager::stream_release(_channel_index);
+}
+
+bool ihdma_stream::high_priority() const
+{
+    return hdma_manager::stream_high_priority(_channel_index);
+}
+
+void ihdma_stream::publish()
+{
+    int write_index = _write_index;
+    BN_ASSERT(write_index >= 0, "next_table has not been called");
+
+    _published_index = int8_t(write_index);
+    _write_index = -1;
+    hdma_manager::stream_start(_channel_index, _tables_ptr + (write_index * _table_size()), _elements, _words,
+                               _destination_ptr);
+}
+
+void ihdma_stream::stop()
+{
+    _published_index = -1;
+    hdma_manager::stream_stop(_channel_index);
+}
+
+int ihdma_stream::_next_table_index()
+{
+    // The table being copied in this frame can't be modified until another one is committed:
+    auto current_source = static_cast<const uint8_t*>(hdma_manager::stream_current_source(_channel_index));
+    int tables_count = _tables_count;
+    int table_size = _table_size();
+    int current_index = -1;
+
+    if(current_source >= _tables_ptr && current_source < _tables_ptr + (tables_count * table_size))
+    {
+        current_index = (current_source - _tables_ptr) / table_size;
+    }
+
+    int published_index = _published_index;
+    int pending_index = published_index != current_index ? published_index : -1;
+    int result = pending_index;
+
+    for(int offset = 1; offset <= tables_count; ++offset)
+    {
+        int index = (published_index + offset) % tables_count;
+
+        if(index != current_index && index != pending_index)
+        {
+            result = index;
+            break;
+        }
+    }
+
+    // If there's only two tables and one of them is pending, the pending one is written again,
+    // since it hasn't started being copied yet:
+    _write_index = int8_t(result);
+    return result;
+}
+
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_particle_system.h"
+
+#include "bn_display.h"
+#include "../hw/include/bn_hw_sprites.h"
+
+namespace bn
+{
+
+int iparticle_system::_update_particles(void* hw_handles, int attr0, int attr1, int attr2)
+{
+    auto handles = static_cast<hw::sprites::handle_type*>(hw_handles) + _first_hw_id;
+    particle* particles = _particles_ptr;
+    fixed_point gravity = _gravity;
+    int size = _size;
+    int graphics_count = _graphics_count;
+    int wait_updates = _wait_updates;
+    int tiles_count_per_graphic = _tiles_count_per_graphic;
+    int width = _shape_size.width();
+    int height = _shape_size.height();
+    int x_offset = (display::width() - width) / 2;
+    int y_offset = (display::height() - height) / 2;
+    int index = 0;
+
+    while(index < size)
+    {
+        particle& current_particle = particles[index];
+        int life = current_particle.life - 1;
+
+        if(life <= 0)
+        {
+            --size;
+            current_particle = particles[size];
+            continue;
+        }
+
+        current_particle.life = int16_t(life);
+
+        fixed_point velocity = current_particle.velocity + gravity;
+        fixed_point position = current_particle.position + velocity;
+        current_particle.velocity = velocity;
+        current_particle.position = position;
+
+        if(graphics_count > 1)
+        {
+            if(current_particle.wait_updates)
+            {
+                --current_particle.wait_updates;
+            }
+            else
+            {
+                int graphics_index = current_particle.graphics_index + 1;
+                current_particle.graphics_index = uint8_t(graphics_index == graphics_count ? 0 : graphics_index);
+                current_particle.wait_updates = uint8_t(wait_updates);
+            }
+        }
+
+        hw::sprites::handle_type& handle = handles[index];
+        int x = position.x().right_shift_integer() + x_offset;
+        int y = position.y().right_shift_integer() + y_offset;
+
+        if(x < display::width() && x + width > 0 && y < display::height() && y + height > 0)
+        {
+            handle.attr0 = uint16_t(attr0 | (y & 255));
+            handle.attr1 = uint16_t(attr1 | (x & 511));
+            handle.attr2 = uint16_t(attr2 + (current_particle.graphics_index * tiles_count_per_graphic));
+        }
+        else
+        {
+            hw::sprites::hide_and_destroy(handle);
+        }
+
+        ++index;
+    }
+
+    return size;
+}
+
+}
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#include "bn_particle_system.h"
+
+#include "bn_memory.h"
+#include "bn_sprites.h"
+#include "bn_sprite_item.h"
+#include "bn_particle_emitter.h"
+#include "bn_sprites_manager.h"
+#include "bn_display_manager.h"
+#include "../hw/include/bn_hw_sprites.h"
+
+namespace bn
+{
+
+namespace
+{
+    [[nodiscard]] sprite_tiles_ptr _create_tiles(const sprite_tiles_item& tiles_item)
+    {
+        BN_ASSERT(tiles_item.compression() == compression_type::NONE, "Compressed tiles not supported");
+
+        if(tiles_item.graphics_count() == 1)
+        {
+            return tiles_item.create_tiles();
+        }
+
+        // All tile sets are stored contiguously, so particles can change their tile set without a sprite_tiles_ptr:
+        const span<const tile>& tiles_ref = tiles_item.tiles_ref();
+        int tiles_count = tiles_ref.size();
+        int allocated_tiles_count = tiles_item.tiles_count_per_graphic();
+
+        while(allocated_tiles_count < tiles_count)
+        {
+            allocated_tiles_count *= 2;
+        }
+
+        sprite_tiles_ptr result = sprite_tiles_ptr::allocate(allocated_tiles_count, tiles_item.bpp());
+        optional<span<tile>> vram = result.vram();
+        memory::copy(tiles_ref[0], tiles_count, (*vram)[0]);
+        return result;
+    }
+}
+
+iparticle_system::~iparticle_system()
+{
+    int first_hw_id = _first_hw_id;
+    BN_ASSERT(sprites::reserved_handles_count() == first_hw_id + _max_size,
+              "Particle systems must be destroyed in reverse creation order");
+
+    auto handles = static_cast<hw::sprites::handle_type*>(sprites_manager::hw_handles());
+
+    for(int index = first_hw_id, limit = first_hw_id + _last_size; index < limit; ++index)
+    {
+        hw::sprites::hide_and_destroy(handles[index]);
+    }
+
+    if(int last_size = _last_size)
+    {
+        sprites_manager::update_hw_handles(first_hw_id, first_hw_id + last_size - 1);
+    }
+
+    sprites::set_reserved_handles_count(first_hw_id);
+}
+
+void iparticle_system::set_bg_priority(int bg_priority)
+{
+    BN_ASSERT(bg_priority >= 0 && bg_priority <= 3, "Invalid BG priority: ", bg_priority);
+
+    _bg_priority = bg_priority;
+}
+
+void iparticle_system::set_wait_updates(int wait_updates)
+{
+    BN_ASSERT(wait_updates >= 0 && wait_updates <= 255, "Invalid wait updates: ", wait_updates);
+
+    _wait_updates = wait_updates;
+}
+
+bool iparticle_system::emit(const fixed_point& position, const fixed_point& velocity, int lifetime)
+{
+    BN_ASSERT(lifetime > 0 && lifetime <= numeric_limits<int16_t>::max(), "Invalid lifetime: ", lifetime);
+
+    int size = _size;
+
+    if(size == _max_size)
+    {
+        return false;
+    }
+
+    particle& new_particle = _particles_ptr[size];
+    new_particle.position = position;
+    new_particle.velocity = velocity;
+    new_particle.life = int16_t(lifetime);
+    new_particle.graphics_index = 0;
+    new_particle.wait_updates = uint8_t(_wait_updates);
+    _size = size + 1;
+    return true;
+}
+
+int iparticle_system::emit(particle_emitter& emitter)
+{
+    int particles_count = emitter.update();
+    const fixed_point& position = emitter.position();
+    const fixed_point& velocity = emitter.velocity();
+    const fixed_point& velocity_spread = emitter.velocity_spread();
+    int lifetime = emitter.lifetime();
+
+    for(int index = 0; index < particles_count; ++index)
+    {
+        fixed_point particle_velocity = velocity;
+
+        if(fixed spread_x = velocity_spread.x(); spread_x != 0)
+        {
+            particle_velocity.set_x(particle_velocity.x() + (spread_x * (_random.get_fixed(2) - 1)));
+        }
+
+        if(fixed spread_y = velocity_spread.y(); spread_y != 0)
+        {
+            particle_velocity.set_y(particle_velocity.y() + (spread_y * (_random.get_fixed(2) - 1)));
+        }
+
+        if(! emit(position, particle_velocity, lifetime))
+        {
+            return index;
+        }
+    }
+
+    return particles_count;
+}
+
+void iparticle_system::update()
+{
+    const sprite_palette_ptr& palette = _palette;
+    const sprite_shape_size& shape_size = _shape_size;
+    int attr0 = hw::sprites::first_attributes(0, shape_size.shape(), palette.bpp(), 0, false, false, false,
+                                              display_manager::blending_fade_enabled());
+    int attr1 = hw::sprites::second_attributes(0, shape_size.size(), false, false);
+    int attr2 = hw::sprites::third_attributes(_tiles.id(), palette.id(), _bg_priority);
+
+    void* hw_handles = sprites_manager::hw_handles();
+    int size = _update_particles(hw_handles, attr0, attr1, attr2);
+    int last_size = _last_size;
+    int first_hw_id = _first_hw_id;
+    _size = size;
+    _last_size = size;
+
+    if(size < last_size)
+    {
+        auto handles = static_cast<hw::sprites::handle_type*>(hw_handles);
+
+        for(int index = first_hw_id + size, limit = first_hw_id + last_size; index < limit; ++index)
+        {
+            hw::sprites::hide_and_destroy(handles[index]);
+        }
+
+        size = last_size;
+    }
+
+    if(size)
+    {
+        sprites_manager::update_hw_handles(first_hw_id, first_hw_id + size - 1);
+    }
+}
+
+iparticle_system::iparticle_system(const sprite_item& item, particle* particles_ptr, int max_size) :
+    _tiles(_create_tiles(item.tiles_item())),
+    _palette(item.palette_item().create_palette()),
+    _shape_size(item.shape_size()),
+    _particles_ptr(particles_ptr),
+    _max_size(max_size),
+    _first_hw_id(sprites::reserved_handles_count()),
+    _graphics_count(item.tiles_item().graphics_count()),
+    _tiles_count_per_graphic(item.tiles_item().tiles_count_per_graphic())
+{
+    sprites::set_reserved_handles_count(_first_hw_id + max_size);
+}
+
+}
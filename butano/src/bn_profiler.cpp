@@ -6,8 +6,10 @@
 #include "bn_profiler.h"
 
 #if BN_CFG_PROFILER_ENABLED
+    #include "bn_log.h"
     #include "bn_timer.h"
-    #include "bn_optional.h"
+    #include "bn_timers.h"
+    #include "bn_vector.h"
     #include "bn_unordered_map.h"
 
     namespace _bn::profiler
@@ -16,15 +18,28 @@
         {
             static_assert(BN_CFG_PROFILER_MAX_ENTRIES > 0);
             static_assert(bn::power_of_two(BN_CFG_PROFILER_MAX_ENTRIES));
+            static_assert(BN_CFG_PROFILER_MAX_DEPTH > 0);
+            static_assert(BN_CFG_PROFILER_HISTOGRAM_SIZE > 1);
+
+            constexpr int histogram_size = BN_CFG_PROFILER_HISTOGRAM_SIZE;
+            constexpr int bucket_ticks = bn::max(bn::timers::ticks_per_frame() / (histogram_size - 1), 1);
+
+            class active_entry
+            {
+
+            public:
+                const char* id;
+                unsigned id_hash;
+                int children_ticks;
+                bn::timer timer;
+            };
 
             class static_data
             {
 
             public:
                 ticks_map ticks_per_entry;
-                bn::optional<bn::timer> current_timer;
-                const char* current_id = nullptr;
-                unsigned current_id_hash;
+                bn::vector<active_entry, BN_CFG_PROFILER_MAX_DEPTH> active_entries;
             };
 
             BN_DATA_EWRAM static_data data;
@@ -33,37 +48,115 @@
         void start(const char* id, unsigned id_hash)
         {
             BN_ASSERT(id, "Id is null");
-            BN_ASSERT(! data.current_id, "There's already an active id: ", data.current_id);
+            BN_ASSERT(! data.active_entries.full(), "Too many nested ids: ", id);
 
-            data.current_id = id;
-            data.current_id_hash = id_hash;
-            data.current_timer = bn::timer();
+            data.active_entries.push_back(active_entry{ id, id_hash, 0, bn::timer() });
         }
 
         void stop()
         {
-            BN_ASSERT(data.current_id, "There's no active id");
+            BN_ASSERT(! data.active_entries.empty(), "There's no active id");
 
-            int timer_ticks = data.current_timer->elapsed_ticks();
+            const active_entry& entry = data.active_entries.back();
+            int timer_ticks = entry.timer.elapsed_ticks();
             auto timer_ticks_64 = int64_t(timer_ticks);
-            ticks& ticks = data.ticks_per_entry(data.current_id_hash, data.current_id);
+            ticks& ticks = data.ticks_per_entry(entry.id_hash, entry.id);
             ticks.total += timer_ticks_64;
+            ticks.self_total += timer_ticks_64 - entry.children_ticks;
             ticks.max = bn::max(ticks.max, timer_ticks);
-            data.current_id = nullptr;
+            ticks.current_frame += timer_ticks;
+            data.active_entries.pop_back();
+
+            if(data.active_entries.empty())
+            {
+                ticks.parent_id = nullptr;
+            }
+            else
+            {
+                active_entry& parent_entry = data.active_entries.back();
+                parent_entry.children_ticks += timer_ticks;
+                ticks.parent_id = parent_entry.id;
+            }
+        }
+
+        void update_frame()
+        {
+            for(auto& ticks_per_entry_pair : data.ticks_per_entry)
+            {
+                ticks& ticks = ticks_per_entry_pair.second;
+
+                if(int current_frame = ticks.current_frame)
+                {
+                    int bucket = bn::min(current_frame / bucket_ticks, histogram_size - 1);
+                    ++ticks.histogram[bucket];
+                    ++ticks.frames;
+                    ticks.frame_max = bn::max(ticks.frame_max, current_frame);
+                    ticks.current_frame = 0;
+                }
+            }
         }
 
         const ticks_map& ticks_per_entry()
         {
-            BN_ASSERT(! data.current_id, "There's an active id: ", data.current_id);
+            BN_ASSERT(data.active_entries.empty(), "There's an active id: ", data.active_entries.back().id);
 
             return data.ticks_per_entry;
         }
 
+        int histogram_bucket_ticks()
+        {
+            return bucket_ticks;
+        }
+
+        int percentile_ticks(const ticks& entry_ticks, int percentile)
+        {
+            BN_ASSERT(percentile >= 0 && percentile <= 100, "Invalid percentile: ", percentile);
+
+            int frames = entry_ticks.frames;
+            int target_frames = bn::max((frames * percentile + 99) / 100, 1);
+            int accumulated_frames = 0;
+
+            for(int bucket = 0; bucket < histogram_size - 1; ++bucket)
+            {
+                accumulated_frames += entry_ticks.histogram[bucket];
+
+                if(accumulated_frames >= target_frames)
+                {
+                    return bn::min((bucket + 1) * bucket_ticks, entry_ticks.frame_max);
+                }
+            }
+
+            return entry_ticks.frame_max;
+        }
+
         void reset()
         {
-            BN_ASSERT(! data.current_id, "There's an active id: ", data.current_id);
+            BN_ASSERT(data.active_entries.empty(), "There's an active id: ", data.active_entries.back().id);
 
             data.ticks_per_entry.clear();
         }
     }
+
+    namespace bn::profiler
+    {
+        void log()
+        {
+            const auto& ticks_per_entry = _bn::profiler::ticks_per_entry();
+            BN_LOG("PROFILER results (histogram bucket ticks: ", _bn::profiler::histogram_bucket_ticks(),
+                   ", ticks per frame: ", timers::ticks_per_frame(), ')');
+
+            for(const auto& ticks_per_entry_pair : ticks_per_entry)
+            {
+                const _bn::profiler::ticks& ticks = ticks_per_entry_pair.second;
+                const char* parent_id = ticks.parent_id ? ticks.parent_id : "-";
+
+                BN_LOG(ticks_per_entry_pair.first, " parent: ", parent_id, " total: ", ticks.total,
+                       " self: ", ticks.self_total, " max: ", ticks.max, " frames: ", ticks.frames,
+                       " p50: ", _bn::profiler::percentile_ticks(ticks, 50),
+                       " p95: ", _bn::profiler::percentile_ticks(ticks, 95),
+                       " p99: ", _bn::profiler::percentile_ticks(ticks, 99),
+                       " over_budget: ", ticks.histogram[BN_CFG_PROFILER_HISTOGRAM_SIZE - 1]);
+            }
+        }
+    }
 #endif
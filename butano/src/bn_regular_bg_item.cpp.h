@@ -42,6 +42,16 @@ optional<regular_bg_ptr> regular_bg_item::create_bg_optional(const fixed_point&
     return regular_bg_ptr::create_optional(position, *this);
 }
 
+regular_bg_ptr regular_bg_item::create_streamed_bg(fixed x, fixed y) const
+{
+    return regular_bg_ptr::create(x, y, regular_bg_map_ptr::create_streamed(*this));
+}
+
+regular_bg_ptr regular_bg_item::create_streamed_bg(const fixed_point& position) const
+{
+    return regular_bg_ptr::create(position, regular_bg_map_ptr::create_streamed(*this));
+}
+
 optional<regular_bg_map_ptr> regular_bg_item::find_map() const
 {
     return regular_bg_map_ptr::find(*this);
@@ -67,4 +77,9 @@ optional<regular_bg_map_ptr> regular_bg_item::create_new_map_optional() const
     return regular_bg_map_ptr::create_new_optional(*this);
 }
 
+regular_bg_map_ptr regular_bg_item::create_streamed_map() const
+{
+    return regular_bg_map_ptr::create_streamed(*this);
+}
+
 }
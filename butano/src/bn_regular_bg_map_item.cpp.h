@@ -6,6 +6,7 @@
 #include "bn_regular_bg_map_item.h"
 
 #include "bn_bg_palette_ptr.h"
+#include "bn_bg_blocks_manager.h"
 #include "bn_regular_bg_map_ptr.h"
 #include "bn_regular_bg_tiles_ptr.h"
 #include "../hw/include/bn_hw_decompress.h"
@@ -26,6 +27,14 @@ regular_bg_map_item regular_bg_map_item::decompress(regular_bg_map_cell& decompr
 
     regular_bg_map_item result = *this;
 
+    if(_compression != compression_type::NONE && big())
+    {
+        bg_blocks_manager::decompress_big_map(_cells_ptr, _compression, _dimensions, false, &decompressed_cells_ref);
+        result._cells_ptr = &decompressed_cells_ref;
+        result._compression = compression_type::NONE;
+        return result;
+    }
+
     switch(_compression)
     {
 
@@ -50,6 +59,12 @@ regular_bg_map_item regular_bg_map_item::decompress(regular_bg_map_cell& decompr
         result._compression = compression_type::NONE;
         break;
 
+    case compression_type::LZ4:
+        hw::decompress::lz4(_cells_ptr, &decompressed_cells_ref);
+        result._cells_ptr = &decompressed_cells_ref;
+        result._compression = compression_type::NONE;
+        break;
+
     default:
         BN_ERROR("Unknown compression type: ", int(_compression));
         break;
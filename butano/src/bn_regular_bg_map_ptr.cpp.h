@@ -74,6 +74,29 @@ regular_bg_map_ptr regular_bg_map_ptr::create_new(const regular_bg_item& item)
     return regular_bg_map_ptr(handle);
 }
 
+regular_bg_map_ptr regular_bg_map_ptr::create_streamed(
+        const regular_bg_map_item& map_item, const regular_bg_tiles_item& tiles_item, bg_palette_ptr palette)
+{
+    int handle = bg_blocks_manager::create_streamed_regular_map(
+                map_item, span<const uint16_t>(), tiles_item, move(palette));
+    return regular_bg_map_ptr(handle);
+}
+
+regular_bg_map_ptr regular_bg_map_ptr::create_streamed(
+        const regular_bg_map_item& map_item, const span<const uint16_t>& tile_indexes,
+        const regular_bg_tiles_item& tiles_item, bg_palette_ptr palette)
+{
+    int handle = bg_blocks_manager::create_streamed_regular_map(map_item, tile_indexes, tiles_item, move(palette));
+    return regular_bg_map_ptr(handle);
+}
+
+regular_bg_map_ptr regular_bg_map_ptr::create_streamed(const regular_bg_item& item)
+{
+    int handle = bg_blocks_manager::create_streamed_regular_map(
+                item.map_item(), span<const uint16_t>(), item.tiles_item(), item.palette_item().create_palette());
+    return regular_bg_map_ptr(handle);
+}
+
 regular_bg_map_ptr regular_bg_map_ptr::allocate(
         const size& dimensions, regular_bg_tiles_ptr tiles, bg_palette_ptr palette)
 {
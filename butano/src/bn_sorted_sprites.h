@@ -7,6 +7,7 @@
 #define BN_SORTED_SPRITES_H
 
 #include "bn_pool.h"
+#include "bn_unordered_map.h"
 #include "bn_config_sprites.h"
 #include "bn_sprites_manager_item.h"
 
@@ -36,15 +37,98 @@ namespace bn::sorted_sprites
             return _items;
         }
 
+        [[nodiscard]] int y_sorted_items_count() const
+        {
+            return _y_sorted_items_count;
+        }
+
+        void add_y_sorted_items_count(int count)
+        {
+            _y_sorted_items_count += count;
+        }
+
+        // Incremental insertion sort, so it's cheap when items barely move between frames.
+        // Items which are not y sorted keep their place in the list:
+        [[nodiscard]] bool sort_by_y()
+        {
+            intrusive_list<sprites_manager_item>& items = _items;
+            intrusive_list<sprites_manager_item>::iterator end = items.end();
+            intrusive_list<sprites_manager_item>::iterator it = items.begin();
+            bool sorted = false;
+
+            while(it != end)
+            {
+                sprites_manager_item& item = *it;
+                ++it;
+
+                if(item.y_sorted)
+                {
+                    intrusive_list<sprites_manager_item>::iterator begin = items.begin();
+                    intrusive_list<sprites_manager_item>::iterator position_it = it;
+                    --position_it;
+
+                    intrusive_list<sprites_manager_item>::iterator item_it = position_it;
+                    int y = item.hot_item->hw_position.y();
+
+                    while(position_it != begin)
+                    {
+                        intrusive_list<sprites_manager_item>::iterator previous_it = position_it;
+                        --previous_it;
+
+                        const sprites_manager_item& previous_item = *previous_it;
+
+                        if(! previous_item.y_sorted || previous_item.hot_item->hw_position.y() >= y)
+                        {
+                            break;
+                        }
+
+                        position_it = previous_it;
+                    }
+
+                    if(position_it != item_it)
+                    {
+                        sprites_manager_item& position_item = *position_it;
+                        items.erase(item);
+                        items.insert(position_item, item);
+                        sorted = true;
+                    }
+                }
+            }
+
+            return sorted;
+        }
+
     private:
         sort_key _sort_key;
         intrusive_list<sprites_manager_item> _items;
+        int _y_sorted_items_count = 0;
     };
 
 
     using layers_type = intrusive_list<layer>;
 
 
+    // Sprites sort keys are lower than 2^18 (background priority in the upper bits, z order in the lower 16 bits),
+    // so they can be grouped in buckets of 32 keys tracked by a two levels bitmap:
+    constexpr int keys_per_bucket_shift = 5;
+    constexpr int buckets_count = (4 << 16) >> keys_per_bucket_shift;
+    constexpr int bucket_words_count = buckets_count / 32;
+    constexpr int bucket_summary_words_count = bucket_words_count / 32;
+
+
+    [[nodiscard]] constexpr int maps_max_size()
+    {
+        int result = 1;
+
+        while(result < BN_CFG_SPRITES_MAX_ITEMS * 2)
+        {
+            result *= 2;
+        }
+
+        return result;
+    }
+
+
     class sorter
     {
 
@@ -56,33 +140,28 @@ namespace bn::sorted_sprites
 
         void insert(sprites_manager_item& item)
         {
-            layers_type& layer_ptrs = _layer_ptrs;
             sort_key item_sort_key = item.sprite_sort_key;
-            layers_type::iterator layers_end = layer_ptrs.end();
-            layers_type::iterator layers_it = lower_bound(layer_ptrs.begin(), layers_end, item_sort_key,
-                    [](const layer& layer, sort_key sort_key) {
-                        return layer.layer_sort_key() < sort_key;
-                    });
+            auto layers_map_it = _layers_map.find(item_sort_key.data());
+            layer* layer_ptr;
 
-            if(layers_it == layers_end)
+            if(layers_map_it != _layers_map.end())
             {
-                BN_ASSERT(! _layer_pool.full(), "No more sprite sort layers available");
-
-                layer& pool_layer = _layer_pool.create(item_sort_key);
-                layers_it = layer_ptrs.insert(layers_end, pool_layer);
+                layer_ptr = layers_map_it->second;
             }
-            else if(item_sort_key != layers_it->layer_sort_key())
+            else
             {
-                BN_ASSERT(! _layer_pool.full(), "No more sprite sort layers available");
-
-                layer& pool_layer = _layer_pool.create(item_sort_key);
-                layers_it = layer_ptrs.insert(layers_it, pool_layer);
+                layer_ptr = &_create_layer(item_sort_key);
             }
 
-            layer& layer_ref = *layers_it;
-            layer_ref.items().push_front(item);
+            layer_ptr->items().push_front(item);
+
+            if(item.y_sorted)
+            {
+                layer_ptr->add_y_sorted_items_count(1);
+                ++_y_sorted_items_count;
+            }
 
-            int diff = &layer_ref - reinterpret_cast<layer*>(&layer_ptrs);
+            int diff = layer_ptr - reinterpret_cast<layer*>(&_layer_ptrs);
             item.sort_layer_ptr_diff = int16_t(diff);
         }
 
@@ -92,13 +171,36 @@ namespace bn::sorted_sprites
             intrusive_list<sprites_manager_item>& layer_items = layer->items();
             layer_items.erase(item);
 
+            if(item.y_sorted)
+            {
+                layer->add_y_sorted_items_count(-1);
+                --_y_sorted_items_count;
+            }
+
             if(layer_items.empty())
             {
-                _layer_ptrs.erase(*layer);
-                _layer_pool.destroy(*layer);
+                _destroy_layer(*layer);
             }
         }
 
+        [[nodiscard]] bool sort_by_y()
+        {
+            bool sorted = false;
+
+            if(_y_sorted_items_count)
+            {
+                for(layer& layer : _layer_ptrs)
+                {
+                    if(layer.y_sorted_items_count() > 1 && layer.sort_by_y())
+                    {
+                        sorted = true;
+                    }
+                }
+            }
+
+            return sorted;
+        }
+
         [[nodiscard]] bool put_in_front_of_layer(sprites_manager_item& item)
         {
             layer* layer = _layer_ptr(item.sort_layer_ptr_diff);
@@ -130,13 +232,136 @@ namespace bn::sorted_sprites
         }
 
     private:
-        pool<layer, BN_CFG_SPRITES_MAX_SORT_LAYERS> _layer_pool;
+        pool<layer, BN_CFG_SPRITES_MAX_ITEMS> _layer_pool;
         layers_type _layer_ptrs;
+        unordered_map<unsigned, layer*, maps_max_size()> _layers_map;
+        unordered_map<unsigned, unsigned, maps_max_size()> _bucket_keys_map;
+        unsigned _bucket_words[bucket_words_count] = {};
+        unsigned _bucket_summary_words[bucket_summary_words_count] = {};
+        int _y_sorted_items_count = 0;
 
         [[nodiscard]] layer* _layer_ptr(int diff)
         {
             return reinterpret_cast<layer*>(&_layer_ptrs) + diff;
         }
+
+        [[nodiscard]] layer& _create_layer(sort_key sort_key)
+        {
+            unsigned key = sort_key.data();
+            unsigned bucket = key >> keys_per_bucket_shift;
+            unsigned key_bit = 1u << (key & 31);
+            BN_ASSERT(bucket < unsigned(buckets_count), "Invalid sort key: ", key);
+
+            layer& new_layer = _layer_pool.create(sort_key);
+            _layers_map.insert(key, &new_layer);
+
+            // Find the next used sort key to insert the new layer before it:
+            auto bucket_keys_map_it = _bucket_keys_map.find(bucket);
+            unsigned next_bucket_keys = 0;
+
+            if(bucket_keys_map_it != _bucket_keys_map.end())
+            {
+                unsigned& bucket_keys = bucket_keys_map_it->second;
+                next_bucket_keys = bucket_keys & ~((key_bit << 1) - 1);
+                bucket_keys |= key_bit;
+            }
+            else
+            {
+                _bucket_keys_map.insert(bucket, key_bit);
+                _bucket_words[bucket >> 5] |= 1u << (bucket & 31);
+                _bucket_summary_words[bucket >> 10] |= 1u << ((bucket >> 5) & 31);
+            }
+
+            unsigned next_key;
+
+            if(next_bucket_keys)
+            {
+                next_key = (bucket << keys_per_bucket_shift) + unsigned(__builtin_ctz(next_bucket_keys));
+            }
+            else
+            {
+                int next_bucket = _next_bucket(bucket + 1);
+
+                if(next_bucket < 0)
+                {
+                    _layer_ptrs.push_back(new_layer);
+                    return new_layer;
+                }
+
+                unsigned next_bucket_first_keys = _bucket_keys_map.find(unsigned(next_bucket))->second;
+                next_key = (unsigned(next_bucket) << keys_per_bucket_shift) +
+                        unsigned(__builtin_ctz(next_bucket_first_keys));
+            }
+
+            _layer_ptrs.insert(*_layers_map.find(next_key)->second, new_layer);
+            return new_layer;
+        }
+
+        void _destroy_layer(layer& layer)
+        {
+            unsigned key = layer.layer_sort_key().data();
+            unsigned bucket = key >> keys_per_bucket_shift;
+            auto bucket_keys_map_it = _bucket_keys_map.find(bucket);
+            unsigned& bucket_keys = bucket_keys_map_it->second;
+            bucket_keys &= ~(1u << (key & 31));
+
+            if(! bucket_keys)
+            {
+                _bucket_keys_map.erase(bucket_keys_map_it);
+
+                unsigned& bucket_word = _bucket_words[bucket >> 5];
+                bucket_word &= ~(1u << (bucket & 31));
+
+                if(! bucket_word)
+                {
+                    _bucket_summary_words[bucket >> 10] &= ~(1u << ((bucket >> 5) & 31));
+                }
+            }
+
+            _layers_map.erase(key);
+            _layer_ptrs.erase(layer);
+            _layer_pool.destroy(layer);
+        }
+
+        [[nodiscard]] int _next_bucket(unsigned first_bucket) const
+        {
+            if(first_bucket >= unsigned(buckets_count))
+            {
+                return -1;
+            }
+
+            unsigned word_index = first_bucket >> 5;
+
+            if(unsigned word = _bucket_words[word_index] & (~0u << (first_bucket & 31)))
+            {
+                return int((word_index << 5) + unsigned(__builtin_ctz(word)));
+            }
+
+            unsigned next_word_index = word_index + 1;
+
+            if(next_word_index >= unsigned(bucket_words_count))
+            {
+                return -1;
+            }
+
+            unsigned summary_index = next_word_index >> 5;
+            unsigned summary_word = _bucket_summary_words[summary_index] & (~0u << (next_word_index & 31));
+
+            while(! summary_word)
+            {
+                ++summary_index;
+
+                if(summary_index == unsigned(bucket_summary_words_count))
+                {
+                    return -1;
+                }
+
+                summary_word = _bucket_summary_words[summary_index];
+            }
+
+            word_index = (summary_index << 5) + unsigned(__builtin_ctz(summary_word));
+            return int((word_index << 5) + unsigned(__builtin_ctz(_bucket_words[word_index])));
+        }
     };
 }
 
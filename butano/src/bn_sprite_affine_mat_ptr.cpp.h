@@ -46,6 +46,39 @@ optional<sprite_affine_mat_ptr> sprite_affine_mat_ptr::create_optional(const aff
     return result;
 }
 
+optional<sprite_affine_mat_ptr> sprite_affine_mat_ptr::find(const affine_mat_attributes& attributes)
+{
+    int id = sprite_affine_mats_manager::find(attributes);
+    optional<sprite_affine_mat_ptr> result;
+
+    if(id >= 0)
+    {
+        sprite_affine_mats_manager::increase_usages(id);
+        result = sprite_affine_mat_ptr(id);
+    }
+
+    return result;
+}
+
+sprite_affine_mat_ptr sprite_affine_mat_ptr::find_or_create(const affine_mat_attributes& attributes)
+{
+    return sprite_affine_mat_ptr(sprite_affine_mats_manager::find_or_create(attributes));
+}
+
+optional<sprite_affine_mat_ptr> sprite_affine_mat_ptr::find_or_create_optional(
+        const affine_mat_attributes& attributes)
+{
+    int id = sprite_affine_mats_manager::find_or_create_optional(attributes);
+    optional<sprite_affine_mat_ptr> result;
+
+    if(id >= 0)
+    {
+        result = sprite_affine_mat_ptr(id);
+    }
+
+    return result;
+}
+
 sprite_affine_mat_ptr::sprite_affine_mat_ptr(const sprite_affine_mat_ptr& other) :
     sprite_affine_mat_ptr(other._id)
 {
@@ -76,6 +109,11 @@ sprite_affine_mat_ptr::~sprite_affine_mat_ptr()
     }
 }
 
+bool sprite_affine_mat_ptr::shared() const
+{
+    return sprite_affine_mats_manager::shared(_id);
+}
+
 fixed sprite_affine_mat_ptr::rotation_angle() const
 {
     return sprite_affine_mats_manager::rotation_angle(_id);
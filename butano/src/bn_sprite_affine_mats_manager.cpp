@@ -23,53 +23,71 @@ namespace
 
     static_assert(max_items <= numeric_limits<int8_t>::max());
 
+    class registers
+    {
+
+    public:
+        explicit registers(const affine_mat_attributes& attributes) :
+            _pa(int16_t(attributes.pa_register_value())),
+            _pb(int16_t(attributes.pb_register_value())),
+            _pc(int16_t(attributes.pc_register_value())),
+            _pd(int16_t(attributes.pd_register_value()))
+        {
+        }
+
+        [[nodiscard]] unsigned hash() const
+        {
+            unsigned ab = uint16_t(_pa) | (unsigned(uint16_t(_pb)) << 16);
+            unsigned cd = uint16_t(_pc) | (unsigned(uint16_t(_pd)) << 16);
+            return ab ^ (cd * 0x9E3779B1);
+        }
+
+        [[nodiscard]] friend bool operator==(const registers& a, const registers& b) = default;
+
+    private:
+        int16_t _pa;
+        int16_t _pb;
+        int16_t _pc;
+        int16_t _pd;
+    };
+
+
     class item_type
     {
 
     public:
         affine_mat_attributes attributes;
         intrusive_list<sprite_affine_mat_attach_node_type> attached_nodes;
+        unsigned registers_hash;
         unsigned usages;
         bool flipped_identity;
         bool remove_if_not_needed;
+        bool shared;
 
         void init()
         {
             attributes = affine_mat_attributes();
+            update_registers_hash();
             usages = 1;
             flipped_identity = true;
             remove_if_not_needed = false;
+            shared = false;
         }
 
         void init(const affine_mat_attributes& new_attributes)
         {
             attributes = new_attributes;
+            update_registers_hash();
             usages = 1;
             flipped_identity = attributes.flipped_identity();
             remove_if_not_needed = false;
+            shared = false;
         }
-    };
-
-
-    class registers
-    {
 
-    public:
-        explicit registers(const affine_mat_attributes& attributes) :
-            _pa(int16_t(attributes.pa_register_value())),
-            _pb(int16_t(attributes.pb_register_value())),
-            _pc(int16_t(attributes.pc_register_value())),
-            _pd(int16_t(attributes.pd_register_value()))
+        void update_registers_hash()
         {
+            registers_hash = registers(attributes).hash();
         }
-
-        [[nodiscard]] friend bool operator==(const registers& a, const registers& b) = default;
-
-    private:
-        int16_t _pa;
-        int16_t _pb;
-        int16_t _pc;
-        int16_t _pd;
     };
 
 
@@ -125,6 +143,7 @@ namespace
     void _update(int index)
     {
         item_type& item = data.items[index];
+        item.update_registers_hash();
         hw::sprite_affine_mats::setup(item.attributes, data.handles_ptr[index]);
         _update_indexes_to_commit(index);
 
@@ -235,6 +254,55 @@ int create(const affine_mat_attributes& attributes)
     return id;
 }
 
+int find(const affine_mat_attributes& attributes)
+{
+    // Only matrices created with find_or_create are shared, since the other ones can be modified in place:
+    registers attributes_registers(attributes);
+    unsigned attributes_registers_hash = attributes_registers.hash();
+
+    for(int index = 0; index < max_items; ++index)
+    {
+        const item_type& item = data.items[index];
+
+        if(item.usages && item.shared && item.registers_hash == attributes_registers_hash &&
+                registers(item.attributes) == attributes_registers)
+        {
+            return index;
+        }
+    }
+
+    return -1;
+}
+
+int find_or_create(const affine_mat_attributes& attributes)
+{
+    int id = find_or_create_optional(attributes);
+    BN_ASSERT(id >= 0, "No more sprite affine mats available");
+
+    return id;
+}
+
+int find_or_create_optional(const affine_mat_attributes& attributes)
+{
+    int id = find(attributes);
+
+    if(id >= 0)
+    {
+        increase_usages(id);
+    }
+    else
+    {
+        id = create_optional(attributes);
+
+        if(id >= 0)
+        {
+            data.items[id].shared = true;
+        }
+    }
+
+    return id;
+}
+
 int create_optional()
 {
     int item_index = _new_item_index();
@@ -303,6 +371,7 @@ fixed rotation_angle(int id)
 void set_rotation_angle(int id, fixed rotation_angle)
 {
     item_type& item = data.items[id];
+    BN_ASSERT(! item.shared, "Shared sprite affine mats can't be modified");
 
     if(rotation_angle != item.attributes.rotation_angle())
     {
@@ -325,6 +394,7 @@ fixed horizontal_scale(int id)
 void set_horizontal_scale(int id, fixed horizontal_scale)
 {
     item_type& item = data.items[id];
+    BN_ASSERT(! item.shared, "Shared sprite affine mats can't be modified");
 
     if(horizontal_scale != item.attributes.horizontal_scale())
     {
@@ -348,6 +418,7 @@ fixed vertical_scale(int id)
 void set_vertical_scale(int id, fixed vertical_scale)
 {
     item_type& item = data.items[id];
+    BN_ASSERT(! item.shared, "Shared sprite affine mats can't be modified");
 
     if(vertical_scale != item.attributes.vertical_scale())
     {
@@ -366,6 +437,7 @@ void set_vertical_scale(int id, fixed vertical_scale)
 void set_scale(int id, fixed scale)
 {
     item_type& item = data.items[id];
+    BN_ASSERT(! item.shared, "Shared sprite affine mats can't be modified");
 
     if(scale != item.attributes.horizontal_scale() || scale != item.attributes.vertical_scale())
     {
@@ -383,6 +455,7 @@ void set_scale(int id, fixed scale)
 void set_scale(int id, fixed horizontal_scale, fixed vertical_scale)
 {
     item_type& item = data.items[id];
+    BN_ASSERT(! item.shared, "Shared sprite affine mats can't be modified");
 
     if(horizontal_scale != item.attributes.horizontal_scale() || vertical_scale != item.attributes.vertical_scale())
     {
@@ -405,6 +478,7 @@ fixed horizontal_shear(int id)
 void set_horizontal_shear(int id, fixed horizontal_shear)
 {
     item_type& item = data.items[id];
+    BN_ASSERT(! item.shared, "Shared sprite affine mats can't be modified");
 
     if(horizontal_shear != item.attributes.horizontal_shear())
     {
@@ -427,6 +501,7 @@ fixed vertical_shear(int id)
 void set_vertical_shear(int id, fixed vertical_shear)
 {
     item_type& item = data.items[id];
+    BN_ASSERT(! item.shared, "Shared sprite affine mats can't be modified");
 
     if(vertical_shear != item.attributes.vertical_shear())
     {
@@ -444,6 +519,7 @@ void set_vertical_shear(int id, fixed vertical_shear)
 void set_shear(int id, fixed shear)
 {
     item_type& item = data.items[id];
+    BN_ASSERT(! item.shared, "Shared sprite affine mats can't be modified");
 
     if(shear != item.attributes.horizontal_shear() || shear != item.attributes.vertical_shear())
     {
@@ -462,6 +538,7 @@ void set_shear(int id, fixed shear)
 void set_shear(int id, fixed horizontal_shear, fixed vertical_shear)
 {
     item_type& item = data.items[id];
+    BN_ASSERT(! item.shared, "Shared sprite affine mats can't be modified");
 
     if(horizontal_shear != item.attributes.horizontal_shear() || vertical_shear != item.attributes.vertical_shear())
     {
@@ -485,10 +562,12 @@ bool horizontal_flip(int id)
 void set_horizontal_flip(int id, bool horizontal_flip)
 {
     item_type& item = data.items[id];
+    BN_ASSERT(! item.shared, "Shared sprite affine mats can't be modified");
 
     if(horizontal_flip != item.attributes.horizontal_flip())
     {
         item.attributes.set_horizontal_flip(horizontal_flip);
+        item.update_registers_hash();
         hw::sprite_affine_mats::setup(item.attributes, data.handles_ptr[id]);
         _update_indexes_to_commit(id);
     }
@@ -502,15 +581,22 @@ bool vertical_flip(int id)
 void set_vertical_flip(int id, bool vertical_flip)
 {
     item_type& item = data.items[id];
+    BN_ASSERT(! item.shared, "Shared sprite affine mats can't be modified");
 
     if(vertical_flip != item.attributes.vertical_flip())
     {
         item.attributes.set_vertical_flip(vertical_flip);
+        item.update_registers_hash();
         hw::sprite_affine_mats::setup(item.attributes, data.handles_ptr[id]);
         _update_indexes_to_commit(id);
     }
 }
 
+bool shared(int id)
+{
+    return data.items[id].shared;
+}
+
 const affine_mat_attributes& attributes(int id)
 {
     return data.items[id].attributes;
@@ -519,6 +605,7 @@ const affine_mat_attributes& attributes(int id)
 void set_attributes(int id, const affine_mat_attributes& attributes)
 {
     item_type& item = data.items[id];
+    BN_ASSERT(! item.shared, "Shared sprite affine mats can't be modified");
     registers old_registers(item.attributes);
     item.attributes = attributes;
     _update_flipped_identity(id);
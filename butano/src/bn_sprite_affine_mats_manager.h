@@ -38,6 +38,12 @@ namespace bn::sprite_affine_mats_manager
 
     [[nodiscard]] int create(const affine_mat_attributes& attributes);
 
+    [[nodiscard]] int find(const affine_mat_attributes& attributes);
+
+    [[nodiscard]] int find_or_create(const affine_mat_attributes& attributes);
+
+    [[nodiscard]] int find_or_create_optional(const affine_mat_attributes& attributes);
+
     [[nodiscard]] int create_optional();
 
     [[nodiscard]] int create_optional(const affine_mat_attributes& attributes);
@@ -86,6 +92,8 @@ namespace bn::sprite_affine_mats_manager
 
     void set_vertical_flip(int id, bool vertical_flip);
 
+    [[nodiscard]] bool shared(int id);
+
     [[nodiscard]] const affine_mat_attributes& attributes(int id);
 
     void set_attributes(int id, const affine_mat_attributes& attributes);
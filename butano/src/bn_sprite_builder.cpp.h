@@ -12,6 +12,23 @@
 namespace bn
 {
 
+namespace
+{
+    // Shared affine mats can't be modified, so they are replaced with private copies:
+    [[nodiscard]] sprite_affine_mat_ptr* _private_builder_affine_mat(optional<sprite_affine_mat_ptr>& affine_mat)
+    {
+        sprite_affine_mat_ptr* result = affine_mat.get();
+
+        if(result && result->shared())
+        {
+            affine_mat = sprite_affine_mat_ptr::create(result->attributes());
+            result = affine_mat.get();
+        }
+
+        return result;
+    }
+}
+
 sprite_builder::sprite_builder(const sprite_item& item) :
     _item(item),
     _graphics_index(0),
@@ -48,7 +65,7 @@ fixed sprite_builder::rotation_angle() const
 
 sprite_builder& sprite_builder::set_rotation_angle(fixed rotation_angle)
 {
-    if(sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat = _private_builder_affine_mat(_affine_mat))
     {
         affine_mat->set_rotation_angle(rotation_angle);
     }
@@ -72,7 +89,7 @@ fixed sprite_builder::horizontal_scale() const
 
 sprite_builder& sprite_builder::set_horizontal_scale(fixed horizontal_scale)
 {
-    if(sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat = _private_builder_affine_mat(_affine_mat))
     {
         affine_mat->set_horizontal_scale(horizontal_scale);
     }
@@ -96,7 +113,7 @@ fixed sprite_builder::vertical_scale() const
 
 sprite_builder& sprite_builder::set_vertical_scale(fixed vertical_scale)
 {
-    if(sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat = _private_builder_affine_mat(_affine_mat))
     {
         affine_mat->set_vertical_scale(vertical_scale);
     }
@@ -114,7 +131,7 @@ sprite_builder& sprite_builder::set_vertical_scale(fixed vertical_scale)
 
 sprite_builder& sprite_builder::set_scale(fixed scale)
 {
-    if(sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat = _private_builder_affine_mat(_affine_mat))
     {
         affine_mat->set_scale(scale);
     }
@@ -132,7 +149,7 @@ sprite_builder& sprite_builder::set_scale(fixed scale)
 
 sprite_builder& sprite_builder::set_scale(fixed horizontal_scale, fixed vertical_scale)
 {
-    if(sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat = _private_builder_affine_mat(_affine_mat))
     {
         affine_mat->set_scale(horizontal_scale, vertical_scale);
     }
@@ -156,7 +173,7 @@ fixed sprite_builder::horizontal_shear() const
 
 sprite_builder& sprite_builder::set_horizontal_shear(fixed horizontal_shear)
 {
-    if(sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat = _private_builder_affine_mat(_affine_mat))
     {
         affine_mat->set_horizontal_shear(horizontal_shear);
     }
@@ -180,7 +197,7 @@ fixed sprite_builder::vertical_shear() const
 
 sprite_builder& sprite_builder::set_vertical_shear(fixed vertical_shear)
 {
-    if(sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat = _private_builder_affine_mat(_affine_mat))
     {
         affine_mat->set_vertical_shear(vertical_shear);
     }
@@ -198,7 +215,7 @@ sprite_builder& sprite_builder::set_vertical_shear(fixed vertical_shear)
 
 sprite_builder& sprite_builder::set_shear(fixed shear)
 {
-    if(sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat = _private_builder_affine_mat(_affine_mat))
     {
         affine_mat->set_shear(shear);
     }
@@ -216,7 +233,7 @@ sprite_builder& sprite_builder::set_shear(fixed shear)
 
 sprite_builder& sprite_builder::set_shear(fixed horizontal_shear, fixed vertical_shear)
 {
-    if(sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat = _private_builder_affine_mat(_affine_mat))
     {
         affine_mat->set_shear(horizontal_shear, vertical_shear);
     }
@@ -258,7 +275,7 @@ sprite_builder& sprite_builder::set_horizontal_flip(bool horizontal_flip)
 {
     _horizontal_flip = horizontal_flip;
 
-    if(sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat = _private_builder_affine_mat(_affine_mat))
     {
         affine_mat->set_horizontal_flip(horizontal_flip);
     }
@@ -276,7 +293,7 @@ sprite_builder& sprite_builder::set_vertical_flip(bool vertical_flip)
 {
     _vertical_flip = vertical_flip;
 
-    if(sprite_affine_mat_ptr* affine_mat = _affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat = _private_builder_affine_mat(_affine_mat))
     {
         affine_mat->set_vertical_flip(vertical_flip);
     }
@@ -472,9 +472,7 @@ fixed sprite_ptr::rotation_angle() const
 
 void sprite_ptr::set_rotation_angle(fixed rotation_angle)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat_ptr = sprites_manager::private_affine_mat(_handle))
     {
         affine_mat_ptr->set_rotation_angle(rotation_angle);
     }
@@ -500,9 +498,7 @@ fixed sprite_ptr::horizontal_scale() const
 
 void sprite_ptr::set_horizontal_scale(fixed horizontal_scale)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat_ptr = sprites_manager::private_affine_mat(_handle))
     {
         affine_mat_ptr->set_horizontal_scale(horizontal_scale);
     }
@@ -528,9 +524,7 @@ fixed sprite_ptr::vertical_scale() const
 
 void sprite_ptr::set_vertical_scale(fixed vertical_scale)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat_ptr = sprites_manager::private_affine_mat(_handle))
     {
         affine_mat_ptr->set_vertical_scale(vertical_scale);
     }
@@ -544,9 +538,7 @@ void sprite_ptr::set_vertical_scale(fixed vertical_scale)
 
 void sprite_ptr::set_scale(fixed scale)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat_ptr = sprites_manager::private_affine_mat(_handle))
     {
         affine_mat_ptr->set_scale(scale);
     }
@@ -560,9 +552,7 @@ void sprite_ptr::set_scale(fixed scale)
 
 void sprite_ptr::set_scale(fixed horizontal_scale, fixed vertical_scale)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat_ptr = sprites_manager::private_affine_mat(_handle))
     {
         affine_mat_ptr->set_scale(horizontal_scale, vertical_scale);
     }
@@ -588,9 +578,7 @@ fixed sprite_ptr::horizontal_shear() const
 
 void sprite_ptr::set_horizontal_shear(fixed horizontal_shear)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat_ptr = sprites_manager::private_affine_mat(_handle))
     {
         affine_mat_ptr->set_horizontal_shear(horizontal_shear);
     }
@@ -616,9 +604,7 @@ fixed sprite_ptr::vertical_shear() const
 
 void sprite_ptr::set_vertical_shear(fixed vertical_shear)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat_ptr = sprites_manager::private_affine_mat(_handle))
     {
         affine_mat_ptr->set_vertical_shear(vertical_shear);
     }
@@ -632,9 +618,7 @@ void sprite_ptr::set_vertical_shear(fixed vertical_shear)
 
 void sprite_ptr::set_shear(fixed shear)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat_ptr = sprites_manager::private_affine_mat(_handle))
     {
         affine_mat_ptr->set_shear(shear);
     }
@@ -648,9 +632,7 @@ void sprite_ptr::set_shear(fixed shear)
 
 void sprite_ptr::set_shear(fixed horizontal_shear, fixed vertical_shear)
 {
-    optional<sprite_affine_mat_ptr>& affine_mat = sprites_manager::affine_mat(_handle);
-
-    if(sprite_affine_mat_ptr* affine_mat_ptr = affine_mat.get())
+    if(sprite_affine_mat_ptr* affine_mat_ptr = sprites_manager::private_affine_mat(_handle))
     {
         affine_mat_ptr->set_shear(horizontal_shear, vertical_shear);
     }
@@ -692,6 +674,16 @@ void sprite_ptr::put_below()
     sprites_manager::put_below(_handle);
 }
 
+bool sprite_ptr::y_sorted() const
+{
+    return sprites_manager::y_sorted(_handle);
+}
+
+void sprite_ptr::set_y_sorted(bool y_sorted)
+{
+    sprites_manager::set_y_sorted(_handle, y_sorted);
+}
+
 bool sprite_ptr::horizontal_flip() const
 {
     return sprites_manager::horizontal_flip(_handle);
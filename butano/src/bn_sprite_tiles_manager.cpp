@@ -33,6 +33,9 @@ namespace
     static_assert(BN_CFG_SPRITE_TILES_MAX_ITEMS > 0 &&
                   BN_CFG_SPRITE_TILES_MAX_ITEMS <= hw::sprite_tiles::tiles_count());
     static_assert(power_of_two(BN_CFG_SPRITE_TILES_MAX_ITEMS));
+    static_assert(BN_CFG_SPRITE_TILES_MAX_COMMIT_TILES_PER_FRAME > 0);
+    static_assert(BN_CFG_SPRITE_TILES_MAX_CACHED_TILES >= 0 &&
+                  BN_CFG_SPRITE_TILES_MAX_CACHED_TILES <= hw::sprite_tiles::tiles_count());
 
 
     #if BN_CFG_LOG_ENABLED
@@ -44,6 +47,8 @@ namespace
 
     constexpr int max_items = BN_CFG_SPRITE_TILES_MAX_ITEMS;
     constexpr int max_list_items = max_items + 2;
+    constexpr int max_commit_tiles_per_frame = BN_CFG_SPRITE_TILES_MAX_COMMIT_TILES_PER_FRAME;
+    constexpr int max_cached_tiles = BN_CFG_SPRITE_TILES_MAX_CACHED_TILES;
 
 
     enum class status_type
@@ -74,7 +79,7 @@ namespace
 
     private:
         unsigned _status: 2 = unsigned(status_type::FREE);
-        unsigned _compression: 2 = unsigned(compression_type::NONE);
+        unsigned _compression: 3 = unsigned(compression_type::NONE);
 
     public:
         bool commit: 1 = false;
@@ -275,10 +280,13 @@ namespace
         unordered_map<const tile*, int, max_items * 2> items_map;
         vector<uint16_t, max_items> free_items;
         vector<uint16_t, max_items> to_remove_items;
+        vector<uint16_t, max_items> to_remove_lru_items;
         vector<uint16_t, max_items> to_commit_uncompressed_items;
         vector<uint16_t, max_items> to_commit_compressed_items;
+        int commit_tiles_budget = 0;
         uint16_t free_tiles_count = 0;
         uint16_t to_remove_tiles_count = 0;
+        uint16_t cached_items_count = 0;
         bool delay_commit = false;
     };
 
@@ -348,8 +356,24 @@ namespace
 
             BN_LOG(']');
 
+            BN_LOG("to_remove_lru_items: ", data.to_remove_lru_items.size());
+            BN_LOG('[');
+
+            for(int item_index : data.to_remove_lru_items)
+            {
+                const item_type& item = data.items.item(item_index);
+                BN_LOG("    ",
+                        "index: ", item_index,
+                        " - data: ", item.data,
+                        " - start_tile: ", item.start_tile,
+                        " - tiles_count: ", item.tiles_count);
+            }
+
+            BN_LOG(']');
+
             BN_LOG("free_tiles_count: ", data.free_tiles_count);
             BN_LOG("to_remove_tiles_count: ", data.to_remove_tiles_count);
+            BN_LOG("cached_items_count: ", data.cached_items_count);
             BN_LOG("delay_commit: ", (data.delay_commit ? "true" : "false"));
         }
 
@@ -429,6 +453,19 @@ namespace
         data.to_remove_items.erase(to_remove_items_it);
     }
 
+    void _erase_to_remove_lru_item(int id)
+    {
+        auto lru_items_begin = data.to_remove_lru_items.begin();
+        auto lru_items_it = bn::find(lru_items_begin, data.to_remove_lru_items.end(), id);
+
+        if(lru_items_it - lru_items_begin < data.cached_items_count)
+        {
+            --data.cached_items_count;
+        }
+
+        data.to_remove_lru_items.erase(lru_items_it);
+    }
+
     void _insert_to_commit_item(int id, item_type& item)
     {
         if(! item.commit)
@@ -487,6 +524,7 @@ namespace
                 item.usages = 1;
                 item.set_status(status_type::USED);
                 _erase_to_remove_item(id);
+                _erase_to_remove_lru_item(id);
                 data.to_remove_tiles_count -= item.tiles_count;
 
                 if(item.commit_if_recovered)
@@ -532,6 +570,7 @@ namespace
         case status_type::TO_REMOVE:
             item.commit_if_recovered = false;
             data.items_map.erase(item.data);
+            _erase_to_remove_lru_item(id);
             data.to_remove_tiles_count -= tiles_count;
             break;
 
@@ -579,11 +618,128 @@ namespace
         return new_free_item_id;
     }
 
-    [[nodiscard]] int _create_impl(const tile* tiles_data, compression_type compression, int tiles_count)
+    void _remove_item(int id)
+    {
+        auto iterator = data.items.it(id);
+        item_type& item = *iterator;
+
+        if(item.data)
+        {
+            data.items_map.erase(item.data);
+            item.data = nullptr;
+        }
+
+        item.set_status(status_type::FREE);
+        item.commit_if_recovered = false;
+        data.free_tiles_count += item.tiles_count;
+
+        auto next_iterator = iterator;
+        ++next_iterator;
+
+        if(next_iterator != data.items.end())
+        {
+            const item_type& next_item = *next_iterator;
+
+            if(next_item.status() == status_type::FREE)
+            {
+                int next_id = next_iterator.id();
+                item.tiles_count += next_item.tiles_count;
+                _erase_free_item(next_id);
+                data.items.erase(next_id);
+            }
+        }
+
+        if(iterator != data.items.begin())
+        {
+            auto previous_iterator = iterator;
+            --previous_iterator;
+
+            const item_type& previous_item = *previous_iterator;
+
+            if(previous_item.status() == status_type::FREE)
+            {
+                int previous_id = previous_iterator.id();
+                item.start_tile = previous_item.start_tile;
+                item.tiles_count += previous_item.tiles_count;
+                _erase_free_item(previous_id);
+                data.items.erase(previous_id);
+            }
+        }
+
+        _insert_free_item(id);
+    }
+
+    void _remove_lru_item()
     {
-        int to_remove_tiles_count = data.to_remove_tiles_count;
+        int id = data.to_remove_lru_items.front();
+        const item_type& item = data.items.item(id);
+        data.to_remove_lru_items.erase(data.to_remove_lru_items.begin());
+        _erase_to_remove_item(id);
+        data.to_remove_tiles_count -= item.tiles_count;
+
+        if(data.cached_items_count)
+        {
+            --data.cached_items_count;
+        }
+
+        _remove_item(id);
+    }
+
+    void _remove_items(int max_to_remove_tiles_count)
+    {
+        if(max_to_remove_tiles_count)
+        {
+            while(data.to_remove_tiles_count > max_to_remove_tiles_count)
+            {
+                _remove_lru_item();
+            }
+        }
+        else
+        {
+            for(int to_remove_item_index : data.to_remove_lru_items)
+            {
+                _remove_item(to_remove_item_index);
+            }
+
+            data.to_remove_items.clear();
+            data.to_remove_lru_items.clear();
+            data.to_remove_tiles_count = 0;
+            data.cached_items_count = 0;
+        }
+    }
+
+    [[nodiscard]] int _create_free_item(const tile* tiles_data, compression_type compression, int tiles_count,
+                                        bool delay_commit)
+    {
+        if(tiles_count <= data.free_tiles_count)
+        {
+            auto free_items_end = data.free_items.end();
+            auto free_items_it = lower_bound(data.free_items.begin(), free_items_end, tiles_count,
+                                             tiles_count_lower_bound_comparator);
+
+            if(free_items_it != free_items_end)
+            {
+                int id = *free_items_it;
+                int new_free_item_id = _create_item(id, tiles_data, compression, tiles_count, delay_commit);
+
+                if(new_free_item_id >= 0)
+                {
+                    _insert_free_item(new_free_item_id, free_items_it);
+                    ++free_items_it;
+                }
+
+                data.free_items.erase(free_items_it);
+                return id;
+            }
+        }
+
+        return -1;
+    }
 
-        if(tiles_count <= to_remove_tiles_count &&
+    [[nodiscard]] int _create_impl(const tile* tiles_data, compression_type compression, int tiles_count)
+    {
+        // If cache is enabled, items to remove are removed in LRU order instead of being reused by size:
+        if(! max_cached_tiles && tiles_count <= data.to_remove_tiles_count &&
                 (data.delay_commit || compression == compression_type::NONE))
         {
             auto to_remove_items_end = data.to_remove_items.end();
@@ -612,33 +768,30 @@ namespace
             }
         }
 
-        if(tiles_count <= data.free_tiles_count)
-        {
-            auto free_items_end = data.free_items.end();
-            auto free_items_it = lower_bound(data.free_items.begin(), free_items_end, tiles_count,
-                                             tiles_count_lower_bound_comparator);
+        int result = _create_free_item(tiles_data, compression, tiles_count, data.delay_commit);
 
-            if(free_items_it != free_items_end)
-            {
-                int id = *free_items_it;
-                int new_free_item_id = _create_item(id, tiles_data, compression, tiles_count, data.delay_commit);
+        if(result >= 0)
+        {
+            return result;
+        }
 
-                if(new_free_item_id >= 0)
-                {
-                    _insert_free_item(new_free_item_id, free_items_it);
-                    ++free_items_it;
-                }
+        // Cached items were released before the last update, so they are not being displayed:
+        while(data.cached_items_count)
+        {
+            _remove_lru_item();
+            result = _create_free_item(tiles_data, compression, tiles_count, data.delay_commit);
 
-                data.free_items.erase(free_items_it);
-                return id;
+            if(result >= 0)
+            {
+                return result;
             }
         }
 
-        if(to_remove_tiles_count)
+        if(data.to_remove_tiles_count)
         {
-            update();
+            _remove_items(0);
             data.delay_commit = true;
-            return _create_impl(tiles_data, compression, tiles_count);
+            return _create_free_item(tiles_data, compression, tiles_count, true);
         }
 
         return -1;
@@ -651,29 +804,15 @@ namespace
             return -1;
         }
 
-        if(tiles_count <= data.free_tiles_count)
-        {
-            auto free_items_end = data.free_items.end();
-            auto free_items_it = lower_bound(data.free_items.begin(), free_items_end, tiles_count,
-                                             tiles_count_lower_bound_comparator);
-
-            if(free_items_it != free_items_end)
-            {
-                int id = *free_items_it;
-                int new_free_item_id = _create_item(id, nullptr, compression_type::NONE, tiles_count, false);
-
-                if(new_free_item_id >= 0)
-                {
-                    _insert_free_item(new_free_item_id, free_items_it);
-                    ++free_items_it;
-                }
+        int result = _create_free_item(nullptr, compression_type::NONE, tiles_count, false);
 
-                data.free_items.erase(free_items_it);
-                return id;
-            }
+        while(result < 0 && data.cached_items_count)
+        {
+            _remove_lru_item();
+            result = _create_free_item(nullptr, compression_type::NONE, tiles_count, false);
         }
 
-        return -1;
+        return result;
     }
 }
 
@@ -965,6 +1104,7 @@ void decrease_usages(int id)
         item.commit_if_recovered = item.commit;
         _erase_to_commit_item(id, item);
         _insert_to_remove_item(id);
+        data.to_remove_lru_items.push_back(uint16_t(id));
         data.to_remove_tiles_count += item.tiles_count;
     }
 
@@ -1079,102 +1219,61 @@ optional<span<tile>> vram(int id)
 
 void update()
 {
-    if(data.to_remove_tiles_count)
+    if(data.to_remove_tiles_count > max_cached_tiles)
     {
         BN_SPRITE_TILES_LOG("sprite_tiles_manager - UPDATE");
 
-        auto begin = data.items.begin();
-        auto end = data.items.end();
-
-        for(int to_remove_item_index : data.to_remove_items)
-        {
-            auto iterator = data.items.it(to_remove_item_index);
-            item_type& item = *iterator;
-
-            if(item.data)
-            {
-                data.items_map.erase(item.data);
-                item.data = nullptr;
-            }
-
-            item.set_status(status_type::FREE);
-            item.commit_if_recovered = false;
-            data.free_tiles_count += item.tiles_count;
-
-            auto next_iterator = iterator;
-            ++next_iterator;
-
-            if(next_iterator != end)
-            {
-                const item_type& next_item = *next_iterator;
-
-                if(next_item.status() == status_type::FREE)
-                {
-                    int next_id = next_iterator.id();
-                    item.tiles_count += next_item.tiles_count;
-                    _erase_free_item(next_id);
-                    data.items.erase(next_id);
-                }
-            }
-
-            if(iterator != begin)
-            {
-                auto previous_iterator = iterator;
-                --previous_iterator;
-
-                const item_type& previous_item = *previous_iterator;
-
-                if(previous_item.status() == status_type::FREE)
-                {
-                    int previous_id = previous_iterator.id();
-                    item.start_tile = previous_item.start_tile;
-                    item.tiles_count += previous_item.tiles_count;
-                    _erase_free_item(previous_id);
-                    data.items.erase(previous_id);
-                }
-            }
-
-            _insert_free_item(to_remove_item_index);
-        }
-
-        data.to_remove_items.clear();
-        data.to_remove_tiles_count = 0;
+        _remove_items(max_cached_tiles);
 
         BN_SPRITE_TILES_LOG_STATUS();
     }
 
+    data.cached_items_count = uint16_t(data.to_remove_lru_items.size());
     data.delay_commit = false;
 }
 
 void commit_uncompressed(bool use_dma)
 {
+    int commit_tiles_budget = max_commit_tiles_per_frame;
+
     if(! data.to_commit_uncompressed_items.empty())
     {
         BN_SPRITE_TILES_LOG("sprite_tiles_manager - COMMIT UNCOMPRESSED");
 
-        if(use_dma)
+        auto items_begin = data.to_commit_uncompressed_items.begin();
+        auto items_end = data.to_commit_uncompressed_items.end();
+        auto items_it = items_begin;
+
+        for(; items_it != items_end; ++items_it)
         {
-            for(int item_index : data.to_commit_uncompressed_items)
+            item_type& item = data.items.item(*items_it);
+            int tiles_count = item.tiles_count;
+
+            // At least one item is committed per frame, even if it doesn't fit in the budget:
+            if(tiles_count > commit_tiles_budget && commit_tiles_budget < max_commit_tiles_per_frame)
             {
-                item_type& item = data.items.item(item_index);
-                hw::sprite_tiles::commit_with_dma(item.data, int(item.start_tile), int(item.tiles_count));
-                item.commit = false;
+                break;
             }
-        }
-        else
-        {
-            for(int item_index : data.to_commit_uncompressed_items)
+
+            if(use_dma)
             {
-                item_type& item = data.items.item(item_index);
-                hw::sprite_tiles::commit_with_cpu(item.data, int(item.start_tile), int(item.tiles_count));
-                item.commit = false;
+                hw::sprite_tiles::commit_with_dma(item.data, int(item.start_tile), tiles_count);
             }
+            else
+            {
+                hw::sprite_tiles::commit_with_cpu(item.data, int(item.start_tile), tiles_count);
+            }
+
+            item.commit = false;
+            commit_tiles_budget -= tiles_count;
         }
 
-        data.to_commit_uncompressed_items.clear();
+        data.to_commit_uncompressed_items.erase(items_begin, items_it);
 
         BN_SPRITE_TILES_LOG_STATUS();
     }
+
+    data.commit_tiles_budget = commit_tiles_budget;
 }
 
 void commit_compressed()
@@ -1183,14 +1282,27 @@ void commit_compressed()
     {
         BN_SPRITE_TILES_LOG("sprite_tiles_manager - COMMIT COMPRESSED");
 
-        for(int item_index : data.to_commit_compressed_items)
+        int commit_tiles_budget = data.commit_tiles_budget;
+        auto items_begin = data.to_commit_compressed_items.begin();
+        auto items_end = data.to_commit_compressed_items.end();
+        auto items_it = items_begin;
+
+        for(; items_it != items_end; ++items_it)
         {
-            item_type& item = data.items.item(item_index);
-            hw::sprite_tiles::commit(item.data, item.compression(), int(item.start_tile), int(item.tiles_count));
+            item_type& item = data.items.item(*items_it);
+            int tiles_count = item.tiles_count;
+
+            if(tiles_count > commit_tiles_budget && commit_tiles_budget < max_commit_tiles_per_frame)
+            {
+                break;
+            }
+
+            hw::sprite_tiles::commit(item.data, item.compression(), int(item.start_tile), tiles_count);
             item.commit = false;
+            commit_tiles_budget -= tiles_count;
         }
 
-        data.to_commit_compressed_items.clear();
+        data.to_commit_compressed_items.erase(items_begin, items_it);
 
         BN_SPRITE_TILES_LOG_STATUS();
     }
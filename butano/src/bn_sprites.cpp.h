@@ -5,6 +5,7 @@
 
 #include "bn_sprites.h"
 
+#include "bn_span.h"
 #include "bn_sprites_manager.h"
 
 namespace bn::sprites
@@ -20,6 +21,22 @@ int available_items_count()
     return sprites_manager::available_items_count();
 }
 
+void set_positions(const span<sprite_ptr>& sprites, const span<const fixed_point>& positions)
+{
+    BN_ASSERT(sprites.size() == positions.size(),
+              "Invalid positions count: ", sprites.size(), " - ", positions.size());
+
+    sprites_manager::set_positions(sprites.data(), positions.data(), sprites.size());
+}
+
+void add_positions(const span<sprite_ptr>& sprites, const span<const fixed_point>& deltas)
+{
+    BN_ASSERT(sprites.size() == deltas.size(),
+              "Invalid deltas count: ", sprites.size(), " - ", deltas.size());
+
+    sprites_manager::add_positions(sprites.data(), deltas.data(), sprites.size());
+}
+
 int reserved_handles_count()
 {
     return sprites_manager::reserved_handles_count();
@@ -30,6 +47,11 @@ void set_reserved_handles_count(int reserved_handles_count)
     return sprites_manager::set_reserved_handles_count(reserved_handles_count);
 }
 
+int dropped_items_count()
+{
+    return sprites_manager::dropped_items_count();
+}
+
 void reload()
 {
     sprites_manager::reload_all();
@@ -5,88 +5,99 @@
 
 #include "bn_sprites_manager.h"
 
+#include "bn_vector.h"
+#include "bn_algorithm.h"
+#include "bn_sprite_ptr.h"
 #include "bn_sorted_sprites.h"
 
 namespace bn::sprites_manager
 {
 
-bool _check_items_on_screen_impl(void* hw_handles, intrusive_list<sorted_sprites::layer>& layers,
+bool _check_items_on_screen_impl(void* hw_handles, sprites_manager_hot_item* hot_items, int hot_items_count,
                                  bool rebuild_handles, int& first_index_to_commit, int& last_index_to_commit)
 {
     auto handles = reinterpret_cast<hw::sprites::handle_type*>(hw_handles);
     int first_index = first_index_to_commit;
     int last_index = last_index_to_commit;
 
-    for(sorted_sprites::layer& layer : layers)
+    for(int index = 0; index < hot_items_count; ++index)
     {
-        for(sprites_manager_item& item : layer.items())
+        sprites_manager_hot_item& hot_item = hot_items[index];
+
+        if(hot_item.check_on_screen)
         {
-            if(item.check_on_screen)
+            #if BN_CFG_SPRITES_GRID_CELL_SIZE
+                if(hot_item.hw_position_outdated)
+                {
+                    hot_item.item->update_hw_position();
+                }
+            #endif
+
+            int x = hot_item.hw_position.x();
+            bool on_screen = false;
+            hot_item.check_on_screen = false;
+
+            if(x < display::width())
             {
-                int x = item.hw_position.x();
-                bool on_screen = false;
-                item.check_on_screen = false;
+                int y = hot_item.hw_position.y();
 
-                if(x < display::width())
+                if(y < display::height())
                 {
-                    int y = item.hw_position.y();
-
-                    if(y < display::height())
+                    if(x + (hot_item.half_width * 2) > 0)
                     {
-                        if(x + (item.half_width * 2) > 0)
+                        if(y + (hot_item.half_height * 2) > 0)
                         {
-                            if(y + (item.half_height * 2) > 0)
-                            {
-                                on_screen = true;
-                            }
+                            on_screen = true;
                         }
                     }
                 }
+            }
 
-                if(item.on_screen != on_screen)
-                {
-                    item.on_screen = on_screen;
+            sprites_manager_item& item = *hot_item.item;
+
+            if(hot_item.on_screen != on_screen)
+            {
+                hot_item.on_screen = on_screen;
 
-                    if(on_screen)
+                if(on_screen)
+                {
+                    if(item.affine_mat)
                     {
-                        if(item.affine_mat)
-                        {
-                            hw::sprites::show_affine(item.double_size, item.handle);
-                        }
-                        else
-                        {
-                            hw::sprites::show_regular(item.handle);
-                        }
+                        hw::sprites::show_affine(item.double_size, item.handle);
                     }
                     else
                     {
-                        hw::sprites::hide(item.handle);
+                        hw::sprites::show_regular(item.handle);
                     }
                 }
-
-                if(! rebuild_handles)
+                else
                 {
-                    int handles_index = item.handles_index;
+                    hw::sprites::hide(item.handle);
+                }
+            }
 
-                    if(handles_index >= 0)
-                    {
-                        hw::sprites::copy_handle(item.handle, handles[handles_index]);
+            if(! rebuild_handles)
+            {
+                int handles_index = item.handles_index;
 
-                        if(handles_index < first_index)
-                        {
-                            first_index = handles_index;
-                        }
+                if(handles_index >= 0)
+                {
+                    hw::sprites::copy_handle(item.handle, handles[handles_index]);
 
-                        if(handles_index > last_index)
-                        {
-                            last_index = handles_index;
-                        }
+                    if(handles_index < first_index)
+                    {
+                        first_index = handles_index;
                     }
-                    else
+
+                    if(handles_index > last_index)
                     {
-                        rebuild_handles = true;
+                        last_index = handles_index;
                     }
                 }
+                else
+                {
+                    rebuild_handles = true;
+                }
             }
         }
     }
@@ -96,18 +107,115 @@ bool _check_items_on_screen_impl(void* hw_handles, intrusive_list<sorted_sprites
     return rebuild_handles;
 }
 
-int _rebuild_handles_impl(int reserved_handles_count, void* hw_handles, intrusive_list<sorted_sprites::layer>& layers)
+#if BN_CFG_SPRITES_OVERFLOW_MODE == BN_SPRITES_OVERFLOW_MODE_FLICKER && ! BN_CFG_SPRITES_MULTIPLEXING_HANDLES
+    namespace
+    {
+        [[nodiscard]] int _rebuild_handles_with_flicker(
+                int reserved_handles_count, hw::sprites::handle_type* handles,
+                intrusive_list<sorted_sprites::layer>& layers, unsigned& overflow_rotation, int& dropped_items_count)
+        {
+            // Layers which fit in the available handles are always shown,
+            // the remaining handles are assigned to the items of the next layers in a round-robin fashion:
+            int available_handles_count = hw::sprites::count() - reserved_handles_count;
+            int stable_items_count = 0;
+            int overflow_items_count = 0;
+
+            for(sorted_sprites::layer& layer : layers)
+            {
+                int layer_items_count = 0;
+
+                for(const sprites_manager_item& item : layer.items())
+                {
+                    layer_items_count += item.hot_item->on_screen;
+                }
+
+                if(! overflow_items_count && stable_items_count + layer_items_count <= available_handles_count)
+                {
+                    stable_items_count += layer_items_count;
+                }
+                else
+                {
+                    overflow_items_count += layer_items_count;
+                }
+            }
+
+            int shown_overflow_items_count = available_handles_count - stable_items_count;
+            int first_overflow_index = int(overflow_rotation % unsigned(overflow_items_count));
+            int visible_items_count = reserved_handles_count;
+            int overflow_index = -stable_items_count;
+
+            for(sorted_sprites::layer& layer : layers)
+            {
+                for(sprites_manager_item& item : layer.items())
+                {
+                    if(item.hot_item->on_screen)
+                    {
+                        int rotated_index = overflow_index - first_overflow_index;
+                        ++overflow_index;
+
+                        if(rotated_index < 0)
+                        {
+                            rotated_index += overflow_items_count;
+                        }
+
+                        if(overflow_index <= 0 || rotated_index < shown_overflow_items_count)
+                        {
+                            hw::sprites::copy_handle(item.handle, handles[visible_items_count]);
+                            item.handles_index = int8_t(visible_items_count);
+                            ++visible_items_count;
+                            continue;
+                        }
+                    }
+
+                    item.handles_index = -1;
+                }
+            }
+
+            overflow_rotation += unsigned(shown_overflow_items_count);
+            dropped_items_count = overflow_items_count - shown_overflow_items_count;
+            return visible_items_count;
+        }
+    }
+#endif
+
+int _rebuild_handles_impl(int reserved_handles_count, void* hw_handles, intrusive_list<sorted_sprites::layer>& layers,
+                          [[maybe_unused]] void* multiplexed_items, [[maybe_unused]] unsigned& overflow_rotation,
+                          int& dropped_items_count)
 {
     auto handles = reinterpret_cast<hw::sprites::handle_type*>(hw_handles);
     int visible_items_count = reserved_handles_count;
+    dropped_items_count = 0;
+
+    #if BN_CFG_SPRITES_MULTIPLEXING_HANDLES
+        auto& multiplexed_items_ref = *static_cast<ivector<sprites_manager_item*>*>(multiplexed_items);
+        multiplexed_items_ref.clear();
+    #endif
 
     for(sorted_sprites::layer& layer : layers)
     {
         for(sprites_manager_item& item : layer.items())
         {
-            if(item.on_screen)
+            if(item.hot_item->on_screen)
             {
-                #if BN_CFG_ASSERT_ENABLED
+                #if BN_CFG_SPRITES_MULTIPLEXING_HANDLES
+                    if(visible_items_count == hw::sprites::count() - BN_CFG_SPRITES_MULTIPLEXING_HANDLES) [[unlikely]]
+                    {
+                        if(multiplexed_items_ref.full())
+                        {
+                            return -1;
+                        }
+
+                        multiplexed_items_ref.push_back(&item);
+                        item.handles_index = -1;
+                        continue;
+                    }
+                #elif BN_CFG_SPRITES_OVERFLOW_MODE == BN_SPRITES_OVERFLOW_MODE_FLICKER
+                    if(visible_items_count == hw::sprites::count()) [[unlikely]]
+                    {
+                        return _rebuild_handles_with_flicker(reserved_handles_count, handles, layers,
+                                                             overflow_rotation, dropped_items_count);
+                    }
+                #elif BN_CFG_ASSERT_ENABLED
                     if(visible_items_count == hw::sprites::count()) [[unlikely]]
                     {
                         return -1;
@@ -128,23 +236,175 @@ int _rebuild_handles_impl(int reserved_handles_count, void* hw_handles, intrusiv
     return visible_items_count;
 }
 
-bool _update_cameras_impl(intrusive_list<sorted_sprites::layer>& layers)
+#if BN_CFG_SPRITES_MULTIPLEXING_HANDLES
+    namespace
+    {
+        constexpr int multiplexing_handles = BN_CFG_SPRITES_MULTIPLEXING_HANDLES;
+        constexpr int multiplexing_row_words = multiplexing_handles * 2;
+
+        void _fill_multiplexing_rows(const hw::sprites::handle_type& handle, int affine_value, int first_row,
+                                     int last_row, uint32_t* table_column)
+        {
+            uint32_t first_word = unsigned(handle.attr0) | (unsigned(handle.attr1) << 16);
+            uint32_t second_word = unsigned(handle.attr2) | (unsigned(uint16_t(affine_value)) << 16);
+            uint32_t* table_ptr = table_column + (first_row * multiplexing_row_words);
+
+            for(int row = first_row; row < last_row; ++row)
+            {
+                table_ptr[0] = first_word;
+                table_ptr[1] = second_word;
+                table_ptr += multiplexing_row_words;
+            }
+        }
+    }
+#endif
+
+int _multiplex_items_impl([[maybe_unused]] void* multiplexed_items, [[maybe_unused]] void* hw_handles,
+                          [[maybe_unused]] uint16_t* multiplexing_table)
+{
+    int dropped_items_count = 0;
+
+    #if BN_CFG_SPRITES_MULTIPLEXING_HANDLES
+        // Each table row is written by HDMA in the H-Blank after its scanline.
+        // Sprites of the next scanline are being drawn by then, so a handle can be rewritten in the H-Blank
+        // after the last scanline of its current sprite only if the next one starts one scanline later:
+        auto& multiplexed_items_ref = *static_cast<ivector<sprites_manager_item*>*>(multiplexed_items);
+        auto handles = reinterpret_cast<hw::sprites::handle_type*>(hw_handles) +
+                hw::sprites::count() - multiplexing_handles;
+        auto table = reinterpret_cast<uint32_t*>(multiplexing_table);
+        const sprites_manager_item* first_items[multiplexing_handles] = {};
+        const sprites_manager_item* last_items[multiplexing_handles] = {};
+        int last_items_bottom[multiplexing_handles];
+        int first_rows[multiplexing_handles];
+        constexpr int last_row = display::height() - 1;
+
+        sort(multiplexed_items_ref.begin(), multiplexed_items_ref.end(),
+             [](const sprites_manager_item* a, const sprites_manager_item* b)
+        {
+            return a->hot_item->hw_position.y() < b->hot_item->hw_position.y();
+        });
+
+        for(const sprites_manager_item* item : multiplexed_items_ref)
+        {
+            const sprites_manager_hot_item* hot_item = item->hot_item;
+            int top = hot_item->hw_position.y();
+            int handle_index = 0;
+
+            while(handle_index < multiplexing_handles && last_items[handle_index] &&
+                  last_items_bottom[handle_index] >= top)
+            {
+                ++handle_index;
+            }
+
+            if(handle_index == multiplexing_handles) [[unlikely]]
+            {
+                ++dropped_items_count;
+                continue;
+            }
+
+            if(const sprites_manager_item* last_item = last_items[handle_index])
+            {
+                int change_row = last_items_bottom[handle_index] - 1;
+                _fill_multiplexing_rows(last_item->handle, handles[handle_index].fill, first_rows[handle_index],
+                                        change_row, table + (handle_index * 2));
+                first_rows[handle_index] = change_row;
+            }
+            else
+            {
+                first_items[handle_index] = item;
+                first_rows[handle_index] = 0;
+            }
+
+            last_items[handle_index] = item;
+            last_items_bottom[handle_index] = top + (hot_item->half_height * 2);
+        }
+
+        for(int handle_index = 0; handle_index < multiplexing_handles; ++handle_index)
+        {
+            hw::sprites::handle_type& handle = handles[handle_index];
+            uint32_t* table_column = table + (handle_index * 2);
+
+            if(const sprites_manager_item* last_item = last_items[handle_index])
+            {
+                // The last row restores the first sprite for the next frame:
+                const sprites_manager_item* first_item = first_items[handle_index];
+                hw::sprites::copy_handle(first_item->handle, handle);
+                _fill_multiplexing_rows(last_item->handle, handle.fill, first_rows[handle_index], last_row,
+                                        table_column);
+                _fill_multiplexing_rows(handle, handle.fill, last_row, last_row + 1, table_column);
+            }
+            else
+            {
+                hw::sprites::hide_and_destroy(handle.attr0);
+                _fill_multiplexing_rows(handle, handle.fill, 0, last_row + 1, table_column);
+            }
+        }
+    #endif
+
+    return dropped_items_count;
+}
+
+bool _set_positions_impl(const sprite_ptr* sprites_ptr, const fixed_point* positions_ptr, int count, bool add)
 {
     bool check_items_on_screen = false;
 
-    for(sorted_sprites::layer& layer : layers)
+    for(int index = 0; index < count; ++index)
     {
-        for(sprites_manager_item& item : layer.items())
+        auto item = static_cast<sprites_manager_item*>(const_cast<void*>(sprites_ptr[index].handle()));
+        fixed_point old_position = item->position;
+        fixed_point new_position = add ? old_position + positions_ptr[index] : positions_ptr[index];
+        item->position = new_position;
+
+        int diff_x = new_position.x().right_shift_integer() - old_position.x().right_shift_integer();
+        int diff_y = new_position.y().right_shift_integer() - old_position.y().right_shift_integer();
+
+        if(diff_x || diff_y)
         {
-            if(item.camera)
+            sprites_manager_hot_item* hot_item = item->hot_item;
+            point new_hw_position = hot_item->hw_position + point(diff_x, diff_y);
+            hot_item->hw_position = new_hw_position;
+
+            hw::sprites::handle_type& handle = item->handle;
+            hw::sprites::set_x(new_hw_position.x(), handle);
+            hw::sprites::set_y(new_hw_position.y(), handle);
+
+            if(item->visible)
             {
-                item.update_hw_position();
+                hot_item->check_on_screen = true;
+                check_items_on_screen = true;
+            }
+        }
+    }
+
+    return check_items_on_screen;
+}
+
+bool _update_cameras_impl(sprites_manager_hot_item* hot_items, int hot_items_count)
+{
+    bool check_items_on_screen = false;
+
+    for(int index = 0; index < hot_items_count; ++index)
+    {
+        sprites_manager_hot_item& hot_item = hot_items[index];
 
-                if(item.visible)
+        if(hot_item.camera)
+        {
+            #if BN_CFG_SPRITES_GRID_CELL_SIZE
+                // Off-screen sprites are updated later only if they are in a cell overlapping the camera viewport:
+                if(! hot_item.on_screen)
                 {
-                    item.check_on_screen = true;
-                    check_items_on_screen = true;
+                    hot_item.hw_position_outdated = true;
+                    continue;
                 }
+            #endif
+
+            sprites_manager_item& item = *hot_item.item;
+            item.update_hw_position();
+
+            if(item.visible)
+            {
+                hot_item.check_on_screen = true;
+                check_items_on_screen = true;
             }
         }
     }
@@ -9,6 +9,10 @@
 #include "bn_sprite_first_attributes.h"
 #include "bn_sprite_regular_second_attributes.h"
 #include "bn_sorted_sprites.h"
+#include "bn_hdma_manager.h"
+#include "bn_power_of_two.h"
+#include "bn_config_cameras.h"
+#include "bn_cameras_manager.h"
 #include "../hw/include/bn_hw_sprite_affine_mats_constants.h"
 
 #include "bn_sprites.cpp.h"
@@ -24,9 +28,33 @@ namespace bn::sprites_manager
 namespace
 {
     static_assert(BN_CFG_SPRITES_MAX_ITEMS > 0);
+    static_assert(BN_CFG_SPRITES_MULTIPLEXING_HANDLES >= 0 &&
+                  BN_CFG_SPRITES_MULTIPLEXING_HANDLES < hw::sprites::count());
+    static_assert(BN_CFG_SPRITES_OVERFLOW_MODE == BN_SPRITES_OVERFLOW_MODE_ASSERT ||
+                  BN_CFG_SPRITES_OVERFLOW_MODE == BN_SPRITES_OVERFLOW_MODE_FLICKER);
+
+    constexpr int multiplexing_handles = BN_CFG_SPRITES_MULTIPLEXING_HANDLES;
+
+    #if BN_CFG_SPRITES_GRID_CELL_SIZE
+        static_assert(power_of_two(BN_CFG_SPRITES_GRID_CELL_SIZE) && BN_CFG_SPRITES_GRID_CELL_SIZE >= 32);
+
+        constexpr int grid_cell_size_shift = __builtin_ctz(BN_CFG_SPRITES_GRID_CELL_SIZE);
+
+        // Cells wrap around, so worlds of any size can be handled with a fixed number of them:
+        constexpr int grid_columns = 16;
+        constexpr int grid_rows = 16;
+
+        // Maximum distance in pixels from the center of a sprite to its edges (64x64 double size sprites):
+        constexpr int grid_viewport_margin = 64;
+
+        using grid_node_type = sprites_manager_grid_node;
+        using grid_cell_type = intrusive_list<grid_node_type>;
+    #endif
 
     using item_type = sprites_manager_item;
+    using hot_item_type = sprites_manager_hot_item;
     using sorted_items_type = vector<item_type*, BN_CFG_SPRITES_MAX_ITEMS>;
+    using hot_items_type = vector<hot_item_type, BN_CFG_SPRITES_MAX_ITEMS>;
 
     class static_data
     {
@@ -35,7 +63,22 @@ namespace
         pool<item_type, BN_CFG_SPRITES_MAX_ITEMS> items_pool;
         hw::sprites::handle_type handles[hw::sprites::count()];
         sorted_sprites::sorter sorter;
+
+        #if BN_CFG_SPRITES_MULTIPLEXING_HANDLES
+            sorted_items_type multiplexed_items;
+            alignas(int) uint16_t multiplexing_tables[2][display::height() * multiplexing_handles * 4];
+            int multiplexing_table_index = 0;
+            bool multiplexing = false;
+        #endif
+
+        #if BN_CFG_SPRITES_GRID_CELL_SIZE
+            grid_cell_type grid_cells[grid_columns * grid_rows];
+            int grid_camera_items_counts[BN_CFG_CAMERA_MAX_ITEMS] = {};
+        #endif
+
+        unsigned overflow_rotation = 0;
         int reserved_handles_count = 0;
+        int dropped_items_count = 0;
         int first_index_to_commit = 0;
         int last_index_to_commit = hw::sprites::count() - 1;
         int last_visible_items_count = 0;
@@ -46,6 +89,113 @@ namespace
 
     BN_DATA_EWRAM static_data data;
 
+    // Hot items are iterated each frame, so they are stored in IWRAM:
+    hot_items_type hot_items;
+
+    [[nodiscard]] hot_item_type& _create_hot_item()
+    {
+        return hot_items.emplace_back();
+    }
+
+    void _destroy_hot_item(item_type& item)
+    {
+        hot_item_type& hot_item = *item.hot_item;
+        hot_item_type& last_hot_item = hot_items.back();
+
+        if(&hot_item != &last_hot_item)
+        {
+            hot_item = last_hot_item;
+            hot_item.item->hot_item = &hot_item;
+        }
+
+        hot_items.pop_back();
+    }
+
+    #if BN_CFG_SPRITES_GRID_CELL_SIZE
+        [[nodiscard]] grid_cell_type& _grid_cell(int cell_x, int cell_y)
+        {
+            return data.grid_cells[((cell_y & (grid_rows - 1)) * grid_columns) + (cell_x & (grid_columns - 1))];
+        }
+
+        void _grid_insert(item_type& item)
+        {
+            grid_node_type& grid_node = item.grid_node;
+            int cell_x = item.position.x().right_shift_integer() >> grid_cell_size_shift;
+            int cell_y = item.position.y().right_shift_integer() >> grid_cell_size_shift;
+            grid_node.item = &item;
+            grid_node.cell_x = int16_t(cell_x);
+            grid_node.cell_y = int16_t(cell_y);
+            _grid_cell(cell_x, cell_y).push_back(grid_node);
+            ++data.grid_camera_items_counts[item.camera->id()];
+        }
+
+        void _grid_erase(item_type& item)
+        {
+            grid_node_type& grid_node = item.grid_node;
+            _grid_cell(grid_node.cell_x, grid_node.cell_y).erase(grid_node);
+            --data.grid_camera_items_counts[item.camera->id()];
+        }
+
+        void _grid_update(item_type& item)
+        {
+            if(item.camera)
+            {
+                grid_node_type& grid_node = item.grid_node;
+                int cell_x = item.position.x().right_shift_integer() >> grid_cell_size_shift;
+                int cell_y = item.position.y().right_shift_integer() >> grid_cell_size_shift;
+
+                if(cell_x != grid_node.cell_x || cell_y != grid_node.cell_y)
+                {
+                    _grid_cell(grid_node.cell_x, grid_node.cell_y).erase(grid_node);
+                    grid_node.cell_x = int16_t(cell_x);
+                    grid_node.cell_y = int16_t(cell_y);
+                    _grid_cell(cell_x, cell_y).push_back(grid_node);
+                }
+            }
+        }
+
+        // Updates the outdated sprites of the cells overlapping the viewport of the given camera:
+        [[nodiscard]] bool _grid_update_camera(int camera_id)
+        {
+            const fixed_point& camera_position = cameras_manager::position(camera_id);
+            int camera_x = camera_position.x().right_shift_integer();
+            int camera_y = camera_position.y().right_shift_integer();
+            int first_cell_x = (camera_x - (display::width() / 2) - grid_viewport_margin) >> grid_cell_size_shift;
+            int last_cell_x = (camera_x + (display::width() / 2) + grid_viewport_margin) >> grid_cell_size_shift;
+            int first_cell_y = (camera_y - (display::height() / 2) - grid_viewport_margin) >> grid_cell_size_shift;
+            int last_cell_y = (camera_y + (display::height() / 2) + grid_viewport_margin) >> grid_cell_size_shift;
+            bool check_items_on_screen = false;
+
+            for(int cell_y = first_cell_y; cell_y <= last_cell_y; ++cell_y)
+            {
+                for(int cell_x = first_cell_x; cell_x <= last_cell_x; ++cell_x)
+                {
+                    for(grid_node_type& grid_node : _grid_cell(cell_x, cell_y))
+                    {
+                        if(grid_node.cell_x == cell_x && grid_node.cell_y == cell_y)
+                        {
+                            item_type& item = *grid_node.item;
+                            hot_item_type& hot_item = *item.hot_item;
+
+                            if(hot_item.hw_position_outdated && item.camera->id() == camera_id)
+                            {
+                                item.update_hw_position();
+
+                                if(item.visible)
+                                {
+                                    hot_item.check_on_screen = true;
+                                    check_items_on_screen = true;
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            return check_items_on_screen;
+        }
+    #endif
+
     void _update_indexes_to_commit(const item_type& item)
     {
         int handles_index = item.handles_index;
@@ -72,7 +222,7 @@ namespace
 
         if(item.visible)
         {
-            item.check_on_screen = true;
+            item.hot_item->check_on_screen = true;
             data.check_items_on_screen = true;
         }
     }
@@ -132,6 +282,20 @@ namespace
         }
     }
 
+    [[nodiscard]] sprite_affine_mat_ptr* _private_affine_mat(item_type& item)
+    {
+        sprite_affine_mat_ptr* result = item.affine_mat.get();
+
+        // Shared affine mats can't be modified, so they are replaced with private copies:
+        if(result && result->shared())
+        {
+            _assign_affine_mat(item, sprite_affine_mat_ptr::create(result->attributes()));
+            result = item.affine_mat.get();
+        }
+
+        return result;
+    }
+
     void _remove_affine_mat(item_type& item)
     {
         sprite_affine_mat_ptr& item_affine_mat = *item.affine_mat;
@@ -157,6 +321,51 @@ namespace
         }
     }
 
+    #if BN_CFG_SPRITES_MULTIPLEXING_HANDLES
+        void _update_multiplexing()
+        {
+            constexpr int first_handle_index = hw::sprites::count() - multiplexing_handles;
+            bool multiplexing = ! data.multiplexed_items.empty();
+
+            if(multiplexing)
+            {
+                BN_ASSERT(data.multiplexing || ! hdma_manager::low_priority_running(),
+                          "Sprites multiplexing requires low priority HDMA");
+
+                int table_index = (data.multiplexing_table_index + 1) % 2;
+                uint16_t* table = data.multiplexing_tables[table_index];
+                data.multiplexing_table_index = table_index;
+
+                int dropped_items_count = _multiplex_items_impl(&data.multiplexed_items, data.handles, table);
+                data.dropped_items_count = dropped_items_count;
+
+                #if BN_CFG_SPRITES_OVERFLOW_MODE == BN_SPRITES_OVERFLOW_MODE_ASSERT
+                    BN_ASSERT(! dropped_items_count, "Too much on screen sprites");
+                #endif
+
+                uint16_t& destination_ref = *hw::sprites::first_attributes_register(first_handle_index);
+                hdma_manager::low_priority_start(*table, multiplexing_handles * 4, destination_ref);
+            }
+            else if(data.multiplexing)
+            {
+                for(int index = first_handle_index; index < hw::sprites::count(); ++index)
+                {
+                    hw::sprites::hide_and_destroy(data.handles[index]);
+                }
+
+                hdma_manager::low_priority_stop();
+            }
+            else
+            {
+                return;
+            }
+
+            data.multiplexing = multiplexing;
+            data.first_index_to_commit = min(data.first_index_to_commit, first_handle_index);
+            data.last_index_to_commit = hw::sprites::count() - 1;
+        }
+    #endif
+
     void _rebuild_handles()
     {
         if(data.rebuild_handles)
@@ -175,7 +384,15 @@ namespace
                 }
             }
 
-            int visible_items_count = _rebuild_handles_impl(reserved_count, handles, data.sorter.layers());
+            #if BN_CFG_SPRITES_MULTIPLEXING_HANDLES
+                void* multiplexed_items = &data.multiplexed_items;
+            #else
+                void* multiplexed_items = nullptr;
+            #endif
+
+            int visible_items_count = _rebuild_handles_impl(reserved_count, handles, data.sorter.layers(),
+                                                            multiplexed_items, data.overflow_rotation,
+                                                            data.dropped_items_count);
             BN_ASSERT(visible_items_count >= 0, "Too much on screen sprites");
 
             int last_visible_items_count = data.last_visible_items_count;
@@ -194,28 +411,21 @@ namespace
             }
             else
             {
-                int to_commit_items_count;
+                // Reserved handles can be updated before the rebuild (by particle systems for example),
+                // so the range to commit is expanded instead of replaced:
+                int last_index_to_commit = min(max(visible_items_count, last_visible_items_count),
+                                               hw::sprites::count()) - 1;
 
-                if(visible_items_count < last_visible_items_count)
-                {
-                    to_commit_items_count = min(last_visible_items_count, hw::sprites::count() - reserved_count);
-                }
-                else
+                if(last_index_to_commit >= reserved_count)
                 {
-                    to_commit_items_count = visible_items_count;
-                }
-
-                if(to_commit_items_count)
-                {
-                    data.first_index_to_commit = reserved_count;
-                    data.last_index_to_commit = reserved_count + to_commit_items_count - 1;
-                }
-                else
-                {
-                    data.first_index_to_commit = hw::sprites::count();
-                    data.last_index_to_commit = 0;
+                    data.first_index_to_commit = min(data.first_index_to_commit, reserved_count);
+                    data.last_index_to_commit = max(data.last_index_to_commit, last_index_to_commit);
                 }
             }
+
+            #if BN_CFG_SPRITES_MULTIPLEXING_HANDLES
+                _update_multiplexing();
+            #endif
         }
     }
 
@@ -225,7 +435,7 @@ namespace
         {
             data.check_items_on_screen = false;
 
-            if(_check_items_on_screen_impl(data.handles, data.sorter.layers(), data.rebuild_handles,
+            if(_check_items_on_screen_impl(data.handles, hot_items.data(), hot_items.size(), data.rebuild_handles,
                                            data.first_index_to_commit, data.last_index_to_commit))
             {
                 data.rebuild_handles = true;
@@ -259,7 +469,8 @@ id_type create(const fixed_point& position, const sprite_shape_size& shape_size,
 {
     BN_ASSERT(! data.items_pool.full(), "No more sprite items available");
 
-    item_type& new_item = data.items_pool.create(position, shape_size, move(tiles), move(palette));
+    item_type& new_item = data.items_pool.create(_create_hot_item(), position, shape_size, move(tiles),
+                                                 move(palette));
     data.sorter.insert(new_item);
     data.check_items_on_screen = true;
     data.rebuild_handles = true;
@@ -274,7 +485,8 @@ id_type create_optional(const fixed_point& position, const sprite_shape_size& sh
         return nullptr;
     }
 
-    item_type& new_item = data.items_pool.create(position, shape_size, move(tiles), move(palette));
+    item_type& new_item = data.items_pool.create(_create_hot_item(), position, shape_size, move(tiles),
+                                                 move(palette));
     data.sorter.insert(new_item);
     data.check_items_on_screen = true;
     data.rebuild_handles = true;
@@ -285,9 +497,16 @@ id_type create(sprite_builder&& builder)
 {
     BN_ASSERT(! data.items_pool.full(), "No more sprite items available");
 
-    item_type& new_item = data.items_pool.create(move(builder));
+    item_type& new_item = data.items_pool.create(_create_hot_item(), move(builder));
     data.sorter.insert(new_item);
 
+    #if BN_CFG_SPRITES_GRID_CELL_SIZE
+        if(new_item.camera)
+        {
+            _grid_insert(new_item);
+        }
+    #endif
+
     if(new_item.visible)
     {
         data.check_items_on_screen = true;
@@ -320,9 +539,17 @@ id_type create_optional(sprite_builder&& builder)
         return nullptr;
     }
 
-    item_type& new_item = data.items_pool.create(move(builder), move(*tiles_ptr), move(*palette_ptr));
+    item_type& new_item = data.items_pool.create(_create_hot_item(), move(builder), move(*tiles_ptr),
+                                                 move(*palette_ptr));
     data.sorter.insert(new_item);
 
+    #if BN_CFG_SPRITES_GRID_CELL_SIZE
+        if(new_item.camera)
+        {
+            _grid_insert(new_item);
+        }
+    #endif
+
     if(new_item.visible)
     {
         data.check_items_on_screen = true;
@@ -347,6 +574,13 @@ void decrease_usages(id_type id)
     {
         data.sorter.erase(*item);
 
+        #if BN_CFG_SPRITES_GRID_CELL_SIZE
+            if(item->camera)
+            {
+                _grid_erase(*item);
+            }
+        #endif
+
         if(const sprite_affine_mat_ptr* item_affine_mat = item->affine_mat.get())
         {
             sprite_affine_mats_manager::dettach_sprite(item_affine_mat->id(), item->affine_mat_attach_node);
@@ -358,6 +592,7 @@ void decrease_usages(id_type id)
             _update_indexes_to_commit(*item);
         }
 
+        _destroy_hot_item(*item);
         data.items_pool.destroy(*item);
     }
 }
@@ -389,7 +624,8 @@ sprite_shape_size shape_size(id_type id)
 bn::size dimensions(id_type id)
 {
     auto item = static_cast<const item_type*>(id);
-    return bn::size(item->half_width * 2, item->half_height * 2);
+    const hot_item_type* hot_item = item->hot_item;
+    return bn::size(hot_item->half_width * 2, hot_item->half_height * 2);
 }
 
 const sprite_tiles_ptr& tiles(id_type id)
@@ -575,8 +811,18 @@ const fixed_point& position(id_type id)
 
 const point& hw_position(id_type id)
 {
-    auto item = static_cast<const item_type*>(id);
-    return item->hw_position;
+    #if BN_CFG_SPRITES_GRID_CELL_SIZE
+        auto item = static_cast<item_type*>(id);
+
+        if(item->hot_item->hw_position_outdated)
+        {
+            item->update_hw_position();
+        }
+    #else
+        auto item = static_cast<const item_type*>(id);
+    #endif
+
+    return item->hot_item->hw_position;
 }
 
 void set_x(id_type id, fixed x)
@@ -591,13 +837,18 @@ void set_x(id_type id, fixed x)
 
     if(diff)
     {
-        int hw_x = item->hw_position.x() + diff;
-        item->hw_position.set_x(hw_x);
+        hot_item_type* hot_item = item->hot_item;
+        int hw_x = hot_item->hw_position.x() + diff;
+        hot_item->hw_position.set_x(hw_x);
         hw::sprites::set_x(hw_x, item->handle);
 
+        #if BN_CFG_SPRITES_GRID_CELL_SIZE
+            _grid_update(*item);
+        #endif
+
         if(item->visible)
         {
-            item->check_on_screen = true;
+            hot_item->check_on_screen = true;
             data.check_items_on_screen = true;
         }
     }
@@ -615,13 +866,18 @@ void set_y(id_type id, fixed y)
 
     if(diff)
     {
-        int hw_y = item->hw_position.y() + diff;
-        item->hw_position.set_y(hw_y);
+        hot_item_type* hot_item = item->hot_item;
+        int hw_y = hot_item->hw_position.y() + diff;
+        hot_item->hw_position.set_y(hw_y);
         hw::sprites::set_y(hw_y, item->handle);
 
+        #if BN_CFG_SPRITES_GRID_CELL_SIZE
+            _grid_update(*item);
+        #endif
+
         if(item->visible)
         {
-            item->check_on_screen = true;
+            hot_item->check_on_screen = true;
             data.check_items_on_screen = true;
         }
     }
@@ -639,16 +895,21 @@ void set_position(id_type id, const fixed_point& position)
 
     if(diff != point())
     {
-        point new_hw_position = item->hw_position + diff;
-        item->hw_position = new_hw_position;
+        hot_item_type* hot_item = item->hot_item;
+        point new_hw_position = hot_item->hw_position + diff;
+        hot_item->hw_position = new_hw_position;
 
         hw::sprites::handle_type& handle = item->handle;
         hw::sprites::set_x(new_hw_position.x(), handle);
         hw::sprites::set_y(new_hw_position.y(), handle);
 
+        #if BN_CFG_SPRITES_GRID_CELL_SIZE
+            _grid_update(*item);
+        #endif
+
         if(item->visible)
         {
-            item->check_on_screen = true;
+            hot_item->check_on_screen = true;
             data.check_items_on_screen = true;
         }
     }
@@ -719,6 +980,25 @@ void put_below(id_type id)
     }
 }
 
+bool y_sorted(id_type id)
+{
+    auto item = static_cast<const item_type*>(id);
+    return item->y_sorted;
+}
+
+void set_y_sorted(id_type id, bool y_sorted)
+{
+    auto item = static_cast<item_type*>(id);
+
+    if(y_sorted != item->y_sorted)
+    {
+        data.sorter.erase(*item);
+        item->y_sorted = y_sorted;
+        data.sorter.insert(*item);
+        data.rebuild_handles = true;
+    }
+}
+
 bool horizontal_flip(id_type id)
 {
     auto item = static_cast<const item_type*>(id);
@@ -735,7 +1015,7 @@ void set_horizontal_flip(id_type id, bool horizontal_flip)
 {
     auto item = static_cast<item_type*>(id);
 
-    if(sprite_affine_mat_ptr* item_affine_mat = item->affine_mat.get())
+    if(sprite_affine_mat_ptr* item_affine_mat = _private_affine_mat(*item))
     {
         item_affine_mat->set_horizontal_flip(horizontal_flip);
     }
@@ -767,7 +1047,7 @@ void set_vertical_flip(id_type id, bool vertical_flip)
 {
     auto item = static_cast<item_type*>(id);
 
-    if(sprite_affine_mat_ptr* item_affine_mat = item->affine_mat.get())
+    if(sprite_affine_mat_ptr* item_affine_mat = _private_affine_mat(*item))
     {
         item_affine_mat->set_vertical_flip(vertical_flip);
     }
@@ -903,21 +1183,53 @@ void set_visible(id_type id, bool visible)
     {
         item->visible = visible;
 
+        hot_item_type* hot_item = item->hot_item;
+
         if(visible)
         {
-            item->check_on_screen = true;
+            hot_item->check_on_screen = true;
             data.check_items_on_screen = true;
         }
         else
         {
             hw::sprites::hide(item->handle);
-            item->on_screen = false;
-            item->check_on_screen = false;
+            hot_item->on_screen = false;
+            hot_item->check_on_screen = false;
             _update_indexes_to_commit(*item);
         }
     }
 }
 
+void set_positions(const sprite_ptr* sprites_ptr, const fixed_point* positions_ptr, int count)
+{
+    if(_set_positions_impl(sprites_ptr, positions_ptr, count, false))
+    {
+        data.check_items_on_screen = true;
+    }
+
+    #if BN_CFG_SPRITES_GRID_CELL_SIZE
+        for(int index = 0; index < count; ++index)
+        {
+            _grid_update(*static_cast<item_type*>(const_cast<void*>(sprites_ptr[index].handle())));
+        }
+    #endif
+}
+
+void add_positions(const sprite_ptr* sprites_ptr, const fixed_point* deltas_ptr, int count)
+{
+    if(_set_positions_impl(sprites_ptr, deltas_ptr, count, true))
+    {
+        data.check_items_on_screen = true;
+    }
+
+    #if BN_CFG_SPRITES_GRID_CELL_SIZE
+        for(int index = 0; index < count; ++index)
+        {
+            _grid_update(*static_cast<item_type*>(const_cast<void*>(sprites_ptr[index].handle())));
+        }
+    #endif
+}
+
 const optional<camera_ptr>& camera(id_type id)
 {
     auto item = static_cast<const item_type*>(id);
@@ -930,12 +1242,25 @@ void set_camera(id_type id, camera_ptr&& camera)
 
     if(camera != item->camera)
     {
+        #if BN_CFG_SPRITES_GRID_CELL_SIZE
+            if(item->camera)
+            {
+                _grid_erase(*item);
+            }
+        #endif
+
+        hot_item_type* hot_item = item->hot_item;
         item->camera = move(camera);
+        hot_item->camera = true;
         item->update_hw_position();
 
+        #if BN_CFG_SPRITES_GRID_CELL_SIZE
+            _grid_insert(*item);
+        #endif
+
         if(item->visible)
         {
-            item->check_on_screen = true;
+            hot_item->check_on_screen = true;
             data.check_items_on_screen = true;
         }
     }
@@ -947,12 +1272,18 @@ void remove_camera(id_type id)
 
     if(item->camera)
     {
+        #if BN_CFG_SPRITES_GRID_CELL_SIZE
+            _grid_erase(*item);
+        #endif
+
+        hot_item_type* hot_item = item->hot_item;
         item->camera.reset();
+        hot_item->camera = false;
         item->update_hw_position();
 
         if(item->visible)
         {
-            item->check_on_screen = true;
+            hot_item->check_on_screen = true;
             data.check_items_on_screen = true;
         }
     }
@@ -964,6 +1295,12 @@ optional<sprite_affine_mat_ptr>& affine_mat(id_type id)
     return item->affine_mat;
 }
 
+sprite_affine_mat_ptr* private_affine_mat(id_type id)
+{
+    auto item = static_cast<item_type*>(id);
+    return _private_affine_mat(*item);
+}
+
 void set_affine_mat(id_type id, const sprite_affine_mat_ptr& affine_mat)
 {
     auto item = static_cast<item_type*>(id);
@@ -1088,13 +1425,30 @@ int reserved_handles_count()
     return data.reserved_handles_count;
 }
 
+int dropped_items_count()
+{
+    return data.dropped_items_count;
+}
+
+void* hw_handles()
+{
+    return data.handles;
+}
+
+void update_hw_handles(int first_index, int last_index)
+{
+    data.first_index_to_commit = min(data.first_index_to_commit, first_index);
+    data.last_index_to_commit = max(data.last_index_to_commit, last_index);
+}
+
 void set_reserved_handles_count(int reserved_handles_count)
 {
     int old_reserved_handles_count = data.reserved_handles_count;
 
     if(reserved_handles_count != old_reserved_handles_count)
     {
-        BN_ASSERT(reserved_handles_count >= 0 && reserved_handles_count < hw::sprites::count(),
+        BN_ASSERT(reserved_handles_count >= 0 &&
+                  reserved_handles_count < hw::sprites::count() - multiplexing_handles,
                   "Invalid reserved handles count: ", reserved_handles_count);
 
         if(reserved_handles_count > old_reserved_handles_count)
@@ -1110,8 +1464,18 @@ void set_reserved_handles_count(int reserved_handles_count)
             }
         }
 
+        // Only the newly reserved or released handles are hidden, so the other reserved ones are kept:
+        int first_index = min(reserved_handles_count, old_reserved_handles_count);
+        int last_index = max(reserved_handles_count, old_reserved_handles_count) - 1;
+
+        for(int index = first_index; index <= last_index; ++index)
+        {
+            hw::sprites::hide_and_destroy(data.handles[index]);
+        }
+
         data.reserved_handles_count = reserved_handles_count;
-        reload_all();
+        data.rebuild_handles = true;
+        update_hw_handles(first_index, last_index);
     }
 }
 
@@ -1306,7 +1670,17 @@ void fill_hblank_effect_third_attributes([[maybe_unused]] sprite_shape_size shap
 
 void update_cameras()
 {
-    data.check_items_on_screen |= _update_cameras_impl(data.sorter.layers());
+    data.check_items_on_screen |= _update_cameras_impl(hot_items.data(), hot_items.size());
+
+    #if BN_CFG_SPRITES_GRID_CELL_SIZE
+        for(int camera_id = 0; camera_id < BN_CFG_CAMERA_MAX_ITEMS; ++camera_id)
+        {
+            if(data.grid_camera_items_counts[camera_id])
+            {
+                data.check_items_on_screen |= _grid_update_camera(camera_id);
+            }
+        }
+    #endif
 }
 
 void remove_identity_affine_mat_if_not_needed(id_type id)
@@ -1345,6 +1719,28 @@ void update_affine_mat_double_size(id_type id, int affine_mat_id)
 void update()
 {
     sprite_affine_mats_manager::update();
+
+    #if BN_CFG_SPRITES_MULTIPLEXING_HANDLES
+        // Multiplexed sprites don't have handles, so the multiplexing table is rebuilt each frame:
+        if(data.multiplexing)
+        {
+            data.rebuild_handles = true;
+        }
+    #endif
+
+    #if BN_CFG_SPRITES_OVERFLOW_MODE == BN_SPRITES_OVERFLOW_MODE_FLICKER
+        // Dropped sprites are rotated each frame:
+        if(data.dropped_items_count)
+        {
+            data.rebuild_handles = true;
+        }
+    #endif
+
+    if(data.sorter.sort_by_y())
+    {
+        data.rebuild_handles = true;
+    }
+
     _check_items_on_screen();
     _rebuild_handles();
 }
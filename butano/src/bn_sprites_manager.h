@@ -17,8 +17,10 @@ class size;
 class point;
 class camera_ptr;
 class fixed_point;
+class sprite_ptr;
 class sprite_builder;
 class sprite_tiles_ptr;
+class sprites_manager_hot_item;
 class sprite_shape_size;
 class sprite_palette_ptr;
 class affine_mat_attributes;
@@ -104,6 +106,10 @@ namespace sprites_manager
 
     void set_position(id_type id, const fixed_point& position);
 
+    void set_positions(const sprite_ptr* sprites_ptr, const fixed_point* positions_ptr, int count);
+
+    void add_positions(const sprite_ptr* sprites_ptr, const fixed_point* deltas_ptr, int count);
+
     [[nodiscard]] int bg_priority(id_type id);
 
     void set_bg_priority(id_type id, int bg_priority);
@@ -116,6 +122,10 @@ namespace sprites_manager
 
     void put_below(id_type id);
 
+    [[nodiscard]] bool y_sorted(id_type id);
+
+    void set_y_sorted(id_type id, bool y_sorted);
+
     [[nodiscard]] bool horizontal_flip(id_type id);
 
     void set_horizontal_flip(id_type id, bool horizontal_flip);
@@ -156,6 +166,8 @@ namespace sprites_manager
 
     [[nodiscard]] optional<sprite_affine_mat_ptr>& affine_mat(id_type id);
 
+    [[nodiscard]] sprite_affine_mat_ptr* private_affine_mat(id_type id);
+
     void set_affine_mat(id_type id, const sprite_affine_mat_ptr& affine_mat);
 
     void set_affine_mat(id_type id, sprite_affine_mat_ptr&& affine_mat);
@@ -188,6 +200,12 @@ namespace sprites_manager
 
     void set_reserved_handles_count(int reserved_handles_count);
 
+    [[nodiscard]] int dropped_items_count();
+
+    [[nodiscard]] void* hw_handles();
+
+    void update_hw_handles(int first_index, int last_index);
+
     void reload(id_type id);
 
     void reload_blending();
@@ -223,13 +241,20 @@ namespace sprites_manager
     void commit(bool use_dma);
 
     [[nodiscard]] BN_CODE_IWRAM bool _check_items_on_screen_impl(
-            void* hw_handles, intrusive_list<sorted_sprites::layer>& layers, bool rebuild_handles,
+            void* hw_handles, sprites_manager_hot_item* hot_items, int hot_items_count, bool rebuild_handles,
             int& first_index_to_commit, int& last_index_to_commit);
 
     [[nodiscard]] BN_CODE_IWRAM int _rebuild_handles_impl(
-            int reserved_handles_count, void* hw_handles, intrusive_list<sorted_sprites::layer>& layers);
+            int reserved_handles_count, void* hw_handles, intrusive_list<sorted_sprites::layer>& layers,
+            void* multiplexed_items, unsigned& overflow_rotation, int& dropped_items_count);
+
+    [[nodiscard]] BN_CODE_IWRAM int _multiplex_items_impl(
+            void* multiplexed_items, void* hw_handles, uint16_t* multiplexing_table);
+
+    [[nodiscard]] BN_CODE_IWRAM bool _set_positions_impl(
+            const sprite_ptr* sprites_ptr, const fixed_point* positions_ptr, int count, bool add);
 
-    [[nodiscard]] BN_CODE_IWRAM bool _update_cameras_impl(intrusive_list<sorted_sprites::layer>& layers);
+    [[nodiscard]] BN_CODE_IWRAM bool _update_cameras_impl(sprites_manager_hot_item* hot_items, int hot_items_count);
 }
 
 }
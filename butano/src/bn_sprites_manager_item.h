@@ -11,6 +11,7 @@
 #include "bn_sort_key.h"
 #include "bn_camera_ptr.h"
 #include "bn_fixed_point.h"
+#include "bn_config_sprites.h"
 #include "bn_intrusive_list.h"
 #include "bn_display_manager.h"
 #include "bn_sprites_manager.h"
@@ -35,14 +36,50 @@ namespace bn::sorted_sprites
 namespace bn
 {
 
+class sprites_manager_item;
+
+// Data accessed each frame by all sprites, stored contiguously in IWRAM:
+class sprites_manager_hot_item
+{
+
+public:
+    sprites_manager_item* item;
+    point hw_position;
+    int8_t half_width;
+    int8_t half_height;
+    bool on_screen: 1;
+    bool check_on_screen: 1;
+    bool camera: 1;
+    bool hw_position_outdated: 1;
+};
+
+
+#if BN_CFG_SPRITES_GRID_CELL_SIZE
+    // Node of the uniform grid used to cull sprites attached to a camera:
+    class sprites_manager_grid_node : public intrusive_list_node_type
+    {
+
+    public:
+        sprites_manager_item* item;
+        int16_t cell_x;
+        int16_t cell_y;
+    };
+#endif
+
+
 class sprites_manager_item : public intrusive_list_node_type
 {
 
 public:
     sprite_affine_mat_attach_node_type affine_mat_attach_node;
+
+    #if BN_CFG_SPRITES_GRID_CELL_SIZE
+        sprites_manager_grid_node grid_node;
+    #endif
+
     hw::sprites::handle_type handle;
     fixed_point position;
-    point hw_position;
+    sprites_manager_hot_item* hot_item;
     unsigned usages = 1;
     sort_key sprite_sort_key;
     optional<sprite_tiles_ptr> tiles;
@@ -51,15 +88,12 @@ public:
     optional<camera_ptr> camera;
     int16_t sort_layer_ptr_diff;
     int8_t handles_index = -1;
-    int8_t half_width;
-    int8_t half_height;
     unsigned double_size_mode: 2;
     bool double_size: 1;
     bool blending_enabled: 1;
     bool visible: 1;
     bool remove_affine_mat_when_not_needed: 1;
-    bool on_screen: 1;
-    bool check_on_screen: 1;
+    bool y_sorted: 1;
 
     [[nodiscard]] static sprites_manager_item& affine_mat_attach_node_item(
             sprite_affine_mat_attach_node_type& attach_node)
@@ -71,9 +105,10 @@ public:
         return *item;
     }
 
-    sprites_manager_item(const fixed_point& _position, const sprite_shape_size& shape_size,
-                         sprite_tiles_ptr&& _tiles, sprite_palette_ptr&& _palette) :
+    sprites_manager_item(sprites_manager_hot_item& _hot_item, const fixed_point& _position,
+                         const sprite_shape_size& shape_size, sprite_tiles_ptr&& _tiles, sprite_palette_ptr&& _palette) :
         position(_position),
+        hot_item(&_hot_item),
         sprite_sort_key(3, 0),
         tiles(move(_tiles)),
         palette(move(_palette)),
@@ -82,17 +117,19 @@ public:
         blending_enabled(false),
         visible(true),
         remove_affine_mat_when_not_needed(true),
-        on_screen(false),
-        check_on_screen(true)
+        y_sorted(false)
     {
+        _hot_item_init(true);
+
         const sprite_palette_ptr& palette_ref = *palette;
         hw::sprites::setup_regular(shape_size, tiles->id(), palette_ref.id(), palette_ref.bpp(),
                                    display_manager::blending_fade_enabled(), handle);
         update_half_dimensions();
     }
 
-    explicit sprites_manager_item(sprite_builder&& builder) :
+    sprites_manager_item(sprites_manager_hot_item& _hot_item, sprite_builder&& builder) :
         position(builder.position()),
+        hot_item(&_hot_item),
         sprite_sort_key(builder.bg_priority(), builder.z_order()),
         tiles(builder.release_tiles()),
         palette(builder.release_palette()),
@@ -103,14 +140,16 @@ public:
         blending_enabled(builder.blending_enabled()),
         visible(builder.visible()),
         remove_affine_mat_when_not_needed(builder.remove_affine_mat_when_not_needed()),
-        on_screen(false),
-        check_on_screen(builder.visible())
+        y_sorted(builder.y_sorted())
     {
+        _hot_item_init(builder.visible());
         _builder_init(builder);
     }
 
-    sprites_manager_item(sprite_builder&& builder, sprite_tiles_ptr&& _tiles, sprite_palette_ptr&& _palette) :
+    sprites_manager_item(sprites_manager_hot_item& _hot_item, sprite_builder&& builder, sprite_tiles_ptr&& _tiles,
+                         sprite_palette_ptr&& _palette) :
         position(builder.position()),
+        hot_item(&_hot_item),
         sprite_sort_key(builder.bg_priority(), builder.z_order()),
         tiles(move(_tiles)),
         palette(move(_palette)),
@@ -121,9 +160,9 @@ public:
         blending_enabled(builder.blending_enabled()),
         visible(builder.visible()),
         remove_affine_mat_when_not_needed(builder.remove_affine_mat_when_not_needed()),
-        on_screen(false),
-        check_on_screen(builder.visible())
+        y_sorted(builder.y_sorted())
     {
+        _hot_item_init(builder.visible());
         _builder_init(builder);
     }
 
@@ -190,8 +229,9 @@ public:
     void update_half_dimensions()
     {
         pair<int, int> dimensions = hw::sprites::dimensions(handle, double_size);
-        half_width = int8_t(dimensions.first / 2);
-        half_height = int8_t(dimensions.second / 2);
+        sprites_manager_hot_item& hot_item_ref = *hot_item;
+        hot_item_ref.half_width = int8_t(dimensions.first / 2);
+        hot_item_ref.half_height = int8_t(dimensions.second / 2);
         update_hw_position();
     }
 
@@ -209,23 +249,36 @@ public:
 
         update_hw_x(real_x);
         update_hw_y(real_y);
+        hot_item->hw_position_outdated = false;
     }
 
     void update_hw_x(int real_x)
     {
-        int hw_x = real_x + (display::width() / 2) - int(half_width);
-        hw_position.set_x(hw_x);
+        sprites_manager_hot_item& hot_item_ref = *hot_item;
+        int hw_x = real_x + (display::width() / 2) - int(hot_item_ref.half_width);
+        hot_item_ref.hw_position.set_x(hw_x);
         hw::sprites::set_x(hw_x, handle);
     }
 
     void update_hw_y(int real_y)
     {
-        int hw_y = real_y + (display::height() / 2) - int(half_height);
-        hw_position.set_y(hw_y);
+        sprites_manager_hot_item& hot_item_ref = *hot_item;
+        int hw_y = real_y + (display::height() / 2) - int(hot_item_ref.half_height);
+        hot_item_ref.hw_position.set_y(hw_y);
         hw::sprites::set_y(hw_y, handle);
     }
 
 private:
+    void _hot_item_init(bool _check_on_screen)
+    {
+        sprites_manager_hot_item& hot_item_ref = *hot_item;
+        hot_item_ref.item = this;
+        hot_item_ref.on_screen = false;
+        hot_item_ref.check_on_screen = _check_on_screen;
+        hot_item_ref.camera = camera.has_value();
+        hot_item_ref.hw_position_outdated = false;
+    }
+
     void _builder_init(const sprite_builder& builder)
     {
         const sprite_palette_ptr& palette_ref = *palette;
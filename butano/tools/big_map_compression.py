@@ -0,0 +1,137 @@
+"""
+Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+zlib License, see LICENSE file.
+"""
+
+import os
+import shutil
+import struct
+import subprocess
+
+from lz4_compression import lz4_compress
+
+
+# Compressed big maps are split in 32x32 cells chunks which can be decompressed independently.
+#
+# The compressed data starts with the offset in bytes of each chunk (one 32 bits value per chunk, in row-major order),
+# followed by the compressed data of each chunk. Repeated chunks share the same compressed data.
+
+_chunk_size = 32
+_grit_batch_size = 32
+
+
+def big_map_compress(data, width, height, compression, build_folder_path, file_name_no_ext):
+    if compression not in ['lz77', 'run_length', 'lz4']:
+        raise ValueError('Compression not supported by big maps: ' + str(compression))
+
+    cell_bytes = len(data) // (width * height)
+    chunk_row_bytes = _chunk_size * cell_bytes
+    chunks_per_row = width // _chunk_size
+    chunks_per_col = height // _chunk_size
+    chunk_indexes = []
+    unique_chunks = []
+    unique_chunk_indexes = {}
+
+    for chunk_y in range(chunks_per_col):
+        for chunk_x in range(chunks_per_row):
+            chunk = bytearray()
+
+            for row in range((chunk_y * _chunk_size), (chunk_y + 1) * _chunk_size):
+                row_start = ((row * width) + (chunk_x * _chunk_size)) * cell_bytes
+                chunk.extend(data[row_start:row_start + chunk_row_bytes])
+
+            chunk = bytes(chunk)
+            chunk_index = unique_chunk_indexes.get(chunk)
+
+            if chunk_index is None:
+                chunk_index = len(unique_chunks)
+                unique_chunk_indexes[chunk] = chunk_index
+                unique_chunks.append(chunk)
+
+            chunk_indexes.append(chunk_index)
+
+    if compression == 'lz4':
+        compressed_chunks = [lz4_compress(chunk) for chunk in unique_chunks]
+    else:
+        compressed_chunks = _grit_compress(unique_chunks, chunk_row_bytes, compression, build_folder_path,
+                                           file_name_no_ext)
+
+    compressed_chunk_offsets = []
+    compressed_data = bytearray()
+    header_size = len(chunk_indexes) * 4
+
+    for compressed_chunk in compressed_chunks:
+        compressed_chunk_offsets.append(header_size + len(compressed_data))
+        compressed_data.extend(compressed_chunk)
+
+    chunk_offsets = [compressed_chunk_offsets[chunk_index] for chunk_index in chunk_indexes]
+    return struct.pack('<' + str(len(chunk_offsets)) + 'I', *chunk_offsets) + bytes(compressed_data)
+
+
+def _grit_compress(chunks, chunk_row_bytes, compression, build_folder_path, file_name_no_ext):
+    # LZ77 and run-length chunks are compressed by grit, the same encoder used for the rest of the graphics.
+    # Each chunk is stored as a 8bpp bitmap with one pixel per byte, so grit keeps its bytes unchanged:
+    chunks_folder_path = build_folder_path + '/' + file_name_no_ext + '_bn_big_map_chunks'
+    os.makedirs(chunks_folder_path, exist_ok=True)
+
+    try:
+        chunk_file_names = []
+
+        for chunk_index, chunk in enumerate(chunks):
+            chunk_file_name = 'chunk_' + str(chunk_index)
+            _write_8bpp_bmp(chunks_folder_path + '/' + chunk_file_name + '.bmp', chunk, chunk_row_bytes)
+            chunk_file_names.append(chunk_file_name)
+
+        # Chunks are compressed in batches to keep grit command lines short:
+        for batch_index in range(0, len(chunk_file_names), _grit_batch_size):
+            command = ['grit']
+            command.extend(chunks_folder_path + '/' + chunk_file_name + '.bmp'
+                           for chunk_file_name in chunk_file_names[batch_index:batch_index + _grit_batch_size])
+            command.extend(['-gb', '-gB8', '-p!', '-ftb', '-fh!', '-D' + chunks_folder_path])
+
+            if compression == 'lz77':
+                command.append('-gzl')
+            else:
+                command.append('-gzr')
+
+            command = ' '.join(command)
+
+            try:
+                subprocess.check_output(command, shell=True, stderr=subprocess.STDOUT)
+            except subprocess.CalledProcessError as e:
+                raise ValueError('grit call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
+
+        compressed_chunks = []
+
+        for chunk_file_name in chunk_file_names:
+            with open(chunks_folder_path + '/' + chunk_file_name + '.img.bin', 'rb') as compressed_chunk_file:
+                compressed_chunks.append(_align(bytearray(compressed_chunk_file.read())))
+
+        return compressed_chunks
+    finally:
+        shutil.rmtree(chunks_folder_path, ignore_errors=True)
+
+
+def _write_8bpp_bmp(file_path, pixels, width):
+    height = len(pixels) // width
+    header_size = 14 + 40 + (256 * 4)
+    bmp_data = bytearray()
+    bmp_data.extend(struct.pack('<2sIHHI', b'BM', header_size + len(pixels), 0, 0, header_size))
+    bmp_data.extend(struct.pack('<IiiHHIIiiII', 40, width, height, 1, 8, 0, len(pixels), 0, 0, 256, 0))
+
+    for color_index in range(256):
+        bmp_data.extend((color_index, color_index, color_index, 0))
+
+    # BMP rows are stored bottom-up:
+    for row in reversed(range(height)):
+        bmp_data.extend(pixels[row * width:(row + 1) * width])
+
+    with open(file_path, 'wb') as bmp_file:
+        bmp_file.write(bmp_data)
+
+
+def _align(output):
+    while len(output) % 4:
+        output.append(0)
+
+    return bytes(output)
@@ -13,6 +13,8 @@ from multiprocessing import Pool
 
 from bmp import BMP
 from file_info import FileInfo
+from lz4_compression import lz4_compress
+from big_map_compression import big_map_compress
 
 
 def parse_colors_count(info, bmp):
@@ -64,7 +66,7 @@ def parse_bg_bpp_mode(info, file_name_no_ext):
 
 
 def validate_compression(compression):
-    if compression not in ['none', 'lz77', 'run_length', 'huffman', 'auto']:
+    if compression not in ['none', 'lz77', 'run_length', 'huffman', 'lz4', 'auto']:
         raise ValueError('Unknown compression: ' + str(compression))
 
 
@@ -81,6 +83,9 @@ def compression_label(compression):
     if compression == 'huffman':
         return 'compression_type::HUFFMAN'
 
+    if compression == 'lz4':
+        return 'compression_type::LZ4'
+
     raise ValueError('Unknown compression: ' + str(compression))
 
 
@@ -93,6 +98,128 @@ def append_compression_command(tag, compression, command):
         command.append('-' + tag + 'zh')
 
 
+def apply_lz4_compression(build_folder_path, file_name_no_ext, section, compression):
+    # grit doesn't support LZ4 compression, so its uncompressed output is compressed here:
+    if compression == 'lz4':
+        replace_grit_data(build_folder_path, file_name_no_ext, section, lz4_compress)
+
+
+def apply_big_map_compression(build_folder_path, file_name_no_ext, width, height, compression):
+    # Compressed big maps are split in chunks which can be decompressed independently:
+    if compression != 'none':
+        replace_grit_data(build_folder_path, file_name_no_ext, 'Map',
+                          lambda data: big_map_compress(data, width, height, compression, build_folder_path,
+                                                        file_name_no_ext))
+
+
+def replace_grit_data(build_folder_path, file_name_no_ext, section, convert_function):
+    label = file_name_no_ext + '_bn_gfx' + section
+    data_file_path = build_folder_path + '/' + file_name_no_ext + '_bn_gfx.s'
+    header_file_path = build_folder_path + '/' + file_name_no_ext + '_bn_gfx.h'
+    data_sizes = {'.word': 4, '.hword': 2, '.byte': 1}
+
+    with open(data_file_path, 'r') as data_file:
+        data_lines = data_file.read().splitlines()
+
+    label_index = data_lines.index(label + ':')
+    data_end_index = label_index + 1
+    data = bytearray()
+
+    while data_end_index < len(data_lines):
+        data_line_words = data_lines[data_end_index].split(None, 1)
+
+        if len(data_line_words) != 2 or data_line_words[0] not in data_sizes:
+            break
+
+        data_size = data_sizes[data_line_words[0]]
+
+        for value in data_line_words[1].split(','):
+            data.extend(int(value, 0).to_bytes(data_size, 'little'))
+
+        data_end_index += 1
+
+    compressed_data = convert_function(bytes(data))
+    compressed_words = [int.from_bytes(compressed_data[index:index + 4], 'little')
+                        for index in range(0, len(compressed_data), 4)]
+    compressed_lines = []
+
+    for index in range(0, len(compressed_words), 8):
+        compressed_lines.append('\t.word ' + ','.join('0x%08X' % word for word in compressed_words[index:index + 8]))
+
+    data_lines[label_index + 1:data_end_index] = compressed_lines
+
+    for index in range(label_index):
+        if '.global ' + label in data_lines[index]:
+            data_lines[index] = re.sub(r'@ [0-9]+ unsigned chars', '@ ' + str(len(compressed_data)) + ' unsigned chars',
+                                       data_lines[index])
+
+    with open(data_file_path, 'w') as data_file:
+        data_file.write('\n'.join(data_lines) + '\n')
+
+    with open(header_file_path, 'r') as header_file:
+        header_data = header_file.read()
+
+    header_data = re.sub(r'#define ' + label + r'Len [0-9]+', '#define ' + label + 'Len ' + str(len(compressed_data)),
+                         header_data)
+    header_data = re.sub(r'unsigned int ' + label + r'\[[0-9]+]',
+                         'unsigned int ' + label + '[' + str(len(compressed_data) // 4) + ']', header_data)
+    header_data = re.sub(r'unsigned short ' + label + r'\[[0-9]+]',
+                         'unsigned short ' + label + '[' + str(len(compressed_data) // 2) + ']', header_data)
+
+    total_size_match = re.search(r'Total size: (.*) = ([0-9]+)', header_data)
+
+    if total_size_match is not None:
+        sizes = re.sub(r'\b' + str(len(data)) + r'\b', str(len(compressed_data)), total_size_match.group(1), 1)
+        total_size = int(total_size_match.group(2)) - len(data) + len(compressed_data)
+        header_data = header_data[:total_size_match.start()] + 'Total size: ' + sizes + ' = ' + str(total_size) + \
+            header_data[total_size_match.end():]
+
+    with open(header_file_path, 'w') as header_file:
+        header_file.write(header_data)
+
+
+# The "auto" compression option selects the compression with the lowest cost, where:
+#
+#   cost = file size + uncompressed file size * decode cycles per byte * rom_bytes_per_decode_cycle
+#
+# Decode cycles per byte are estimated from the instructions executed per decompressed byte by the inner loops
+# of the decoders in butano/hw/src/bn_hw_decompress.bn_iwram.cpp, relative to an uncompressed copy.
+# They are not exact: the decompress general test (tests/general_tests/include/decompress_tests.h) logs the
+# measured cycles per KB of each decoder, so update this table with these values divided by 1024
+# when the decoders change:
+compression_decode_cycles = {'none': 0, 'lz4': 3, 'run_length': 5, 'lz77': 12, 'huffman': 24}
+
+# Each decode cycle per byte costs 2% of the uncompressed file size.
+# For example, LZ77 is selected over uncompressed data only if it saves at least 24% of the file size,
+# and over LZ4 only if its output is at least 18% of the uncompressed file size smaller than LZ4 output:
+rom_bytes_per_decode_cycle = 0.02
+
+all_compressions = ['none', 'lz4', 'run_length', 'lz77', 'huffman']
+palette_compressions = ['none', 'lz4', 'run_length', 'lz77']
+big_map_compressions = ['none', 'lz4', 'run_length', 'lz77']
+
+
+def select_compression(test_compression, compressions):
+    best_compression = None
+    best_cost = None
+    uncompressed_file_size = None
+
+    for compression in compressions:
+        file_size = test_compression(compression)
+
+        if uncompressed_file_size is None:
+            uncompressed_file_size = file_size
+
+        cost = file_size + (uncompressed_file_size * compression_decode_cycles[compression] *
+                            rom_bytes_per_decode_cycle)
+
+        if best_cost is None or cost < best_cost:
+            best_compression = compression
+            best_cost = cost
+
+    return best_compression
+
+
 def remove_file(file_path):
     if os.path.exists(file_path):
         os.remove(file_path)
@@ -201,37 +328,21 @@ class SpriteItem:
         palette_compression = self.__palette_compression
 
         if tiles_compression == 'auto':
-            tiles_compression, file_size = self.__test_tiles_compression(tiles_compression, 'none', None)
-            tiles_compression, file_size = self.__test_tiles_compression(tiles_compression, 'run_length', file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(tiles_compression, 'lz77', file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(tiles_compression, 'huffman', file_size)
+            tiles_compression = select_compression(self.__test_tiles_compression, all_compressions)
 
         if palette_compression == 'auto':
-            palette_compression, file_size = self.__test_palette_compression(palette_compression, 'none', None)
-            palette_compression, file_size = self.__test_palette_compression(palette_compression, 'run_length',
-                                                                             file_size)
-            palette_compression, file_size = self.__test_palette_compression(palette_compression, 'lz77', file_size)
+            palette_compression = select_compression(self.__test_palette_compression, palette_compressions)
 
         self.__execute_command(tiles_compression, palette_compression)
         return self.__write_header(tiles_compression, palette_compression, False)
 
-    def __test_tiles_compression(self, best_tiles_compression, new_tiles_compression, best_file_size):
-        self.__execute_command(new_tiles_compression, 'none')
-        new_file_size = self.__write_header(new_tiles_compression, 'none', True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_tiles_compression, new_file_size
-
-        return best_tiles_compression, best_file_size
-
-    def __test_palette_compression(self, best_palette_compression, new_palette_compression, best_file_size):
-        self.__execute_command('none', new_palette_compression)
-        new_file_size = self.__write_header('none', new_palette_compression, True)
+    def __test_tiles_compression(self, compression):
+        self.__execute_command(compression, 'none')
+        return self.__write_header(compression, 'none', True)
 
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_palette_compression, new_file_size
-
-        return best_palette_compression, best_file_size
+    def __test_palette_compression(self, compression):
+        self.__execute_command('none', compression)
+        return self.__write_header('none', compression, True)
 
     def __write_header(self, tiles_compression, palette_compression, skip_write):
         name = self.__file_name_no_ext
@@ -315,6 +426,9 @@ class SpriteItem:
         except subprocess.CalledProcessError as e:
             raise ValueError('grit call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
 
+        apply_lz4_compression(self.__build_folder_path, self.__file_name_no_ext, 'Tiles', tiles_compression)
+        apply_lz4_compression(self.__build_folder_path, self.__file_name_no_ext, 'Pal', palette_compression)
+
 
 class SpriteTilesItem:
 
@@ -351,22 +465,14 @@ class SpriteTilesItem:
         compression = self.__compression
 
         if compression == 'auto':
-            compression, file_size = self.__test_compression(compression, 'none', None)
-            compression, file_size = self.__test_compression(compression, 'run_length', file_size)
-            compression, file_size = self.__test_compression(compression, 'lz77', file_size)
-            compression, file_size = self.__test_compression(compression, 'huffman', file_size)
+            compression = select_compression(self.__test_compression, all_compressions)
 
         self.__execute_command(compression)
         return self.__write_header(compression, False)
 
-    def __test_compression(self, best_compression, new_compression, best_file_size):
-        self.__execute_command(new_compression)
-        new_file_size = self.__write_header(new_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
+    def __test_compression(self, compression):
+        self.__execute_command(compression)
+        return self.__write_header(compression, True)
 
     def __write_header(self, compression, skip_write):
         name = self.__file_name_no_ext
@@ -447,6 +553,8 @@ class SpriteTilesItem:
         except subprocess.CalledProcessError as e:
             raise ValueError('grit call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
 
+        apply_lz4_compression(self.__build_folder_path, self.__file_name_no_ext, 'Tiles', compression)
+
 
 class SpritePaletteItem:
 
@@ -468,21 +576,14 @@ class SpritePaletteItem:
         compression = self.__compression
 
         if compression == 'auto':
-            compression, file_size = self.__test_compression(compression, 'none', None)
-            compression, file_size = self.__test_compression(compression, 'run_length', file_size)
-            compression, file_size = self.__test_compression(compression, 'lz77', file_size)
+            compression = select_compression(self.__test_compression, palette_compressions)
 
         self.__execute_command(compression)
         return self.__write_header(compression, False)
 
-    def __test_compression(self, best_compression, new_compression, best_file_size):
-        self.__execute_command(new_compression)
-        new_file_size = self.__write_header(new_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
+    def __test_compression(self, compression):
+        self.__execute_command(compression)
+        return self.__write_header(compression, True)
 
     def __write_header(self, compression, skip_write):
         name = self.__file_name_no_ext
@@ -543,6 +644,8 @@ class SpritePaletteItem:
         except subprocess.CalledProcessError as e:
             raise ValueError('grit call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
 
+        apply_lz4_compression(self.__build_folder_path, self.__file_name_no_ext, 'Pal', compression)
+
 
 class RegularBgItem:
 
@@ -653,58 +756,40 @@ class RegularBgItem:
             except KeyError:
                 self.__map_compression = 'none'
 
+        self.__big_map = self.__width > 64 or self.__height > 64
+
+        if self.__big_map and self.__map_compression == 'huffman':
+            raise ValueError('Huffman compression not supported by big maps')
+
     def process(self):
         tiles_compression = self.__tiles_compression
         palette_compression = self.__palette_compression
         map_compression = self.__map_compression
 
         if tiles_compression == 'auto':
-            tiles_compression, file_size = self.__test_tiles_compression(tiles_compression, 'none', None)
-            tiles_compression, file_size = self.__test_tiles_compression(tiles_compression, 'run_length', file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(tiles_compression, 'lz77', file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(tiles_compression, 'huffman', file_size)
+            tiles_compression = select_compression(self.__test_tiles_compression, all_compressions)
 
         if palette_compression == 'auto':
-            palette_compression, file_size = self.__test_palette_compression(palette_compression, 'none', None)
-            palette_compression, file_size = self.__test_palette_compression(palette_compression, 'run_length',
-                                                                             file_size)
-            palette_compression, file_size = self.__test_palette_compression(palette_compression, 'lz77', file_size)
+            palette_compression = select_compression(self.__test_palette_compression, palette_compressions)
 
         if map_compression == 'auto':
-            map_compression, file_size = self.__test_map_compression(map_compression, 'none', None)
-            map_compression, file_size = self.__test_map_compression(map_compression, 'run_length', file_size)
-            map_compression, file_size = self.__test_map_compression(map_compression, 'lz77', file_size)
-            map_compression, file_size = self.__test_map_compression(map_compression, 'huffman', file_size)
+            map_compression = select_compression(self.__test_map_compression,
+                                                 big_map_compressions if self.__big_map else all_compressions)
 
         self.__execute_command(tiles_compression, palette_compression, map_compression)
         return self.__write_header(tiles_compression, palette_compression, map_compression, False)
 
-    def __test_tiles_compression(self, best_tiles_compression, new_tiles_compression, best_file_size):
-        self.__execute_command(new_tiles_compression, 'none', 'none')
-        new_file_size = self.__write_header(new_tiles_compression, 'none', 'none', True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_tiles_compression, new_file_size
-
-        return best_tiles_compression, best_file_size
-
-    def __test_palette_compression(self, best_palette_compression, new_palette_compression, best_file_size):
-        self.__execute_command('none', new_palette_compression, 'none')
-        new_file_size = self.__write_header('none', new_palette_compression, 'none', True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_palette_compression, new_file_size
+    def __test_tiles_compression(self, compression):
+        self.__execute_command(compression, 'none', 'none')
+        return self.__write_header(compression, 'none', 'none', True)
 
-        return best_palette_compression, best_file_size
+    def __test_palette_compression(self, compression):
+        self.__execute_command('none', compression, 'none')
+        return self.__write_header('none', compression, 'none', True)
 
-    def __test_map_compression(self, best_map_compression, new_map_compression, best_file_size):
-        self.__execute_command('none', 'none', new_map_compression)
-        new_file_size = self.__write_header('none', 'none', new_map_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_map_compression, new_file_size
-
-        return best_map_compression, best_file_size
+    def __test_map_compression(self, compression):
+        self.__execute_command('none', 'none', compression)
+        return self.__write_header('none', 'none', compression, True)
 
     def __write_header(self, tiles_compression, palette_compression, map_compression, skip_write):
         name = self.__file_name_no_ext
@@ -825,7 +910,10 @@ class RegularBgItem:
 
         append_compression_command('g', tiles_compression, command)
         append_compression_command('p', palette_compression, command)
-        append_compression_command('m', map_compression, command)
+
+        if not self.__big_map:
+            append_compression_command('m', map_compression, command)
+
         command.append('-o' + self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
         command = ' '.join(command)
 
@@ -834,6 +922,15 @@ class RegularBgItem:
         except subprocess.CalledProcessError as e:
             raise ValueError('grit call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
 
+        apply_lz4_compression(self.__build_folder_path, self.__file_name_no_ext, 'Tiles', tiles_compression)
+        apply_lz4_compression(self.__build_folder_path, self.__file_name_no_ext, 'Pal', palette_compression)
+
+        if self.__big_map:
+            apply_big_map_compression(self.__build_folder_path, self.__file_name_no_ext, self.__width, self.__height,
+                                      map_compression)
+        else:
+            apply_lz4_compression(self.__build_folder_path, self.__file_name_no_ext, 'Map', map_compression)
+
 
 class RegularBgTilesItem:
 
@@ -854,22 +951,14 @@ class RegularBgTilesItem:
         compression = self.__compression
 
         if compression == 'auto':
-            compression, file_size = self.__test_compression(compression, 'none', None)
-            compression, file_size = self.__test_compression(compression, 'run_length', file_size)
-            compression, file_size = self.__test_compression(compression, 'lz77', file_size)
-            compression, file_size = self.__test_compression(compression, 'huffman', file_size)
+            compression = select_compression(self.__test_compression, all_compressions)
 
         self.__execute_command(compression)
         return self.__write_header(compression, False)
 
-    def __test_compression(self, best_compression, new_compression, best_file_size):
-        self.__execute_command(new_compression)
-        new_file_size = self.__write_header(new_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
+    def __test_compression(self, compression):
+        self.__execute_command(compression)
+        return self.__write_header(compression, True)
 
     def __write_header(self, compression, skip_write):
         name = self.__file_name_no_ext
@@ -949,6 +1038,8 @@ class RegularBgTilesItem:
         except subprocess.CalledProcessError as e:
             raise ValueError('grit call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
 
+        apply_lz4_compression(self.__build_folder_path, self.__file_name_no_ext, 'Tiles', compression)
+
 
 class AffineBgItem:
 
@@ -1031,58 +1122,40 @@ class AffineBgItem:
             except KeyError:
                 self.__map_compression = 'none'
 
+        self.__big_map = self.__width != self.__height or self.__width not in [16, 32, 64, 128]
+
+        if self.__big_map and self.__map_compression == 'huffman':
+            raise ValueError('Huffman compression not supported by big maps')
+
     def process(self):
         tiles_compression = self.__tiles_compression
         palette_compression = self.__palette_compression
         map_compression = self.__map_compression
 
         if tiles_compression == 'auto':
-            tiles_compression, file_size = self.__test_tiles_compression(tiles_compression, 'none', None)
-            tiles_compression, file_size = self.__test_tiles_compression(tiles_compression, 'run_length', file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(tiles_compression, 'lz77', file_size)
-            tiles_compression, file_size = self.__test_tiles_compression(tiles_compression, 'huffman', file_size)
+            tiles_compression = select_compression(self.__test_tiles_compression, all_compressions)
 
         if palette_compression == 'auto':
-            palette_compression, file_size = self.__test_palette_compression(palette_compression, 'none', None)
-            palette_compression, file_size = self.__test_palette_compression(palette_compression, 'run_length',
-                                                                             file_size)
-            palette_compression, file_size = self.__test_palette_compression(palette_compression, 'lz77', file_size)
+            palette_compression = select_compression(self.__test_palette_compression, palette_compressions)
 
         if map_compression == 'auto':
-            map_compression, file_size = self.__test_map_compression(map_compression, 'none', None)
-            map_compression, file_size = self.__test_map_compression(map_compression, 'run_length', file_size)
-            map_compression, file_size = self.__test_map_compression(map_compression, 'lz77', file_size)
-            map_compression, file_size = self.__test_map_compression(map_compression, 'huffman', file_size)
+            map_compression = select_compression(self.__test_map_compression,
+                                                 big_map_compressions if self.__big_map else all_compressions)
 
         self.__execute_command(tiles_compression, palette_compression, map_compression)
         return self.__write_header(tiles_compression, palette_compression, map_compression, False)
 
-    def __test_tiles_compression(self, best_tiles_compression, new_tiles_compression, best_file_size):
-        self.__execute_command(new_tiles_compression, 'none', 'none')
-        new_file_size = self.__write_header(new_tiles_compression, 'none', 'none', True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_tiles_compression, new_file_size
-
-        return best_tiles_compression, best_file_size
-
-    def __test_palette_compression(self, best_palette_compression, new_palette_compression, best_file_size):
-        self.__execute_command('none', new_palette_compression, 'none')
-        new_file_size = self.__write_header('none', new_palette_compression, 'none', True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_palette_compression, new_file_size
+    def __test_tiles_compression(self, compression):
+        self.__execute_command(compression, 'none', 'none')
+        return self.__write_header(compression, 'none', 'none', True)
 
-        return best_palette_compression, best_file_size
+    def __test_palette_compression(self, compression):
+        self.__execute_command('none', compression, 'none')
+        return self.__write_header('none', compression, 'none', True)
 
-    def __test_map_compression(self, best_map_compression, new_map_compression, best_file_size):
-        self.__execute_command('none', 'none', new_map_compression)
-        new_file_size = self.__write_header('none', 'none', new_map_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_map_compression, new_file_size
-
-        return best_map_compression, best_file_size
+    def __test_map_compression(self, compression):
+        self.__execute_command('none', 'none', compression)
+        return self.__write_header('none', 'none', compression, True)
 
     def __write_header(self, tiles_compression, palette_compression, map_compression, skip_write):
         name = self.__file_name_no_ext
@@ -1175,7 +1248,10 @@ class AffineBgItem:
 
         append_compression_command('g', tiles_compression, command)
         append_compression_command('p', palette_compression, command)
-        append_compression_command('m', map_compression, command)
+
+        if not self.__big_map:
+            append_compression_command('m', map_compression, command)
+
         command.append('-o' + self.__build_folder_path + '/' + self.__file_name_no_ext + '_bn_gfx')
         command = ' '.join(command)
 
@@ -1184,6 +1260,15 @@ class AffineBgItem:
         except subprocess.CalledProcessError as e:
             raise ValueError('grit call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
 
+        apply_lz4_compression(self.__build_folder_path, self.__file_name_no_ext, 'Tiles', tiles_compression)
+        apply_lz4_compression(self.__build_folder_path, self.__file_name_no_ext, 'Pal', palette_compression)
+
+        if self.__big_map:
+            apply_big_map_compression(self.__build_folder_path, self.__file_name_no_ext, self.__width, self.__height,
+                                      map_compression)
+        else:
+            apply_lz4_compression(self.__build_folder_path, self.__file_name_no_ext, 'Map', map_compression)
+
 
 class AffineBgTilesItem:
 
@@ -1203,22 +1288,14 @@ class AffineBgTilesItem:
         compression = self.__compression
 
         if compression == 'auto':
-            compression, file_size = self.__test_compression(compression, 'none', None)
-            compression, file_size = self.__test_compression(compression, 'run_length', file_size)
-            compression, file_size = self.__test_compression(compression, 'lz77', file_size)
-            compression, file_size = self.__test_compression(compression, 'huffman', file_size)
+            compression = select_compression(self.__test_compression, all_compressions)
 
         self.__execute_command(compression)
         return self.__write_header(compression, False)
 
-    def __test_compression(self, best_compression, new_compression, best_file_size):
-        self.__execute_command(new_compression)
-        new_file_size = self.__write_header(new_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
+    def __test_compression(self, compression):
+        self.__execute_command(compression)
+        return self.__write_header(compression, True)
 
     def __write_header(self, compression, skip_write):
         name = self.__file_name_no_ext
@@ -1287,6 +1364,8 @@ class AffineBgTilesItem:
         except subprocess.CalledProcessError as e:
             raise ValueError('grit call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
 
+        apply_lz4_compression(self.__build_folder_path, self.__file_name_no_ext, 'Tiles', compression)
+
 
 class BgPaletteItem:
 
@@ -1308,21 +1387,14 @@ class BgPaletteItem:
         compression = self.__compression
 
         if compression == 'auto':
-            compression, file_size = self.__test_compression(compression, 'none', None)
-            compression, file_size = self.__test_compression(compression, 'run_length', file_size)
-            compression, file_size = self.__test_compression(compression, 'lz77', file_size)
+            compression = select_compression(self.__test_compression, palette_compressions)
 
         self.__execute_command(compression)
         return self.__write_header(compression, False)
 
-    def __test_compression(self, best_compression, new_compression, best_file_size):
-        self.__execute_command(new_compression)
-        new_file_size = self.__write_header(new_compression, True)
-
-        if best_file_size is None or new_file_size < best_file_size:
-            return new_compression, new_file_size
-
-        return best_compression, best_file_size
+    def __test_compression(self, compression):
+        self.__execute_command(compression)
+        return self.__write_header(compression, True)
 
     def __write_header(self, compression, skip_write):
         name = self.__file_name_no_ext
@@ -1383,6 +1455,8 @@ class BgPaletteItem:
         except subprocess.CalledProcessError as e:
             raise ValueError('grit call failed (return code ' + str(e.returncode) + '): ' + str(e.output))
 
+        apply_lz4_compression(self.__build_folder_path, self.__file_name_no_ext, 'Pal', compression)
+
 
 class GraphicsFileInfo:
 
@@ -0,0 +1,103 @@
+"""
+Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+zlib License, see LICENSE file.
+"""
+
+import struct
+
+
+# Butano LZ4 like format (it's not compatible with the LZ4 format):
+#
+# * 32 bits header: 0x40 | (decompressed size in bytes << 8).
+# * A sequence of 16 bits tokens: literal half words count in the low byte and match half words count in the high one.
+# * Each token is followed by its literal half words and, if the match half words count is greater than zero,
+#   by a 16 bits offset (in half words) to the match source.
+#
+# Since everything is 16 bits aligned, the decompressor can write directly to VRAM and copy full words most of the time.
+
+_min_match_half_words = 3
+_max_count = 255
+_max_offset = 0xFFFF
+_max_chain_length = 64
+
+
+def lz4_compress(data):
+    if len(data) % 2:
+        raise ValueError('LZ4 compression requires an even number of bytes: ' + str(len(data)))
+
+    half_words = struct.unpack('<' + str(len(data) // 2) + 'H', data)
+    half_words_count = len(half_words)
+    output = bytearray(struct.pack('<I', 0x40 | (len(data) << 8)))
+    chains = {}
+    literals_begin = 0
+    index = 0
+
+    def append_token(literals_end, match_count, match_offset):
+        output.extend(struct.pack('<H', (literals_end - literals_begin) | (match_count << 8)))
+
+        for literal_index in range(literals_begin, literals_end):
+            output.extend(struct.pack('<H', half_words[literal_index]))
+
+        if match_count:
+            output.extend(struct.pack('<H', match_offset))
+
+    def insert(position):
+        if position + _min_match_half_words <= half_words_count:
+            key = half_words[position:position + _min_match_half_words]
+            chain = chains.setdefault(key, [])
+            chain.append(position)
+
+            if len(chain) > _max_chain_length:
+                del chain[0]
+
+    while index < half_words_count:
+        best_count = 0
+        best_offset = 0
+
+        if index + _min_match_half_words <= half_words_count:
+            max_count = min(_max_count, half_words_count - index)
+
+            for candidate in reversed(chains.get(half_words[index:index + _min_match_half_words], [])):
+                offset = index - candidate
+
+                if offset > _max_offset:
+                    break
+
+                count = _min_match_half_words
+
+                while count < max_count and half_words[candidate + count] == half_words[index + count]:
+                    count += 1
+
+                if count > best_count:
+                    best_count = count
+                    best_offset = offset
+
+                    if count == max_count:
+                        break
+
+        if best_count:
+            while index - literals_begin > _max_count:
+                append_token(literals_begin + _max_count, 0, 0)
+                literals_begin += _max_count
+
+            append_token(index, best_count, best_offset)
+
+            for position in range(index, index + best_count):
+                insert(position)
+
+            index += best_count
+            literals_begin = index
+        else:
+            insert(index)
+            index += 1
+
+    while literals_begin < half_words_count:
+        literals_end = min(literals_begin + _max_count, half_words_count)
+        append_token(literals_end, 0, 0)
+        literals_begin = literals_end
+
+    while len(output) % 4:
+        output.append(0)
+
+    return bytes(output)
+
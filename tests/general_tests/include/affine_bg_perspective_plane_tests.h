@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef AFFINE_BG_PERSPECTIVE_PLANE_TESTS_H
+#define AFFINE_BG_PERSPECTIVE_PLANE_TESTS_H
+
+#include "bn_core.h"
+#include "bn_hdma.h"
+#include "bn_size.h"
+#include "bn_color.h"
+#include "bn_timer.h"
+#include "bn_timers.h"
+#include "bn_unique_ptr.h"
+#include "bn_config_hdma.h"
+#include "bn_bg_palette_ptr.h"
+#include "bn_bg_palette_item.h"
+#include "bn_affine_bg_map_ptr.h"
+#include "bn_affine_bg_tiles_ptr.h"
+#include "bn_affine_bg_perspective_plane.h"
+#include "tests.h"
+
+class affine_bg_perspective_plane_tests : public tests
+{
+
+public:
+    affine_bg_perspective_plane_tests() :
+        tests("affine_bg_perspective_plane")
+    {
+        bn::affine_bg_map_ptr map = bn::affine_bg_map_ptr::allocate(
+                    bn::size(32, 32), bn::affine_bg_tiles_ptr::allocate(1),
+                    bn::bg_palette_ptr::create(bn::bg_palette_item(colors, bn::bpp_mode::BPP_8)));
+        bn::affine_bg_ptr bg = bn::affine_bg_ptr::create(0, 0, bn::move(map));
+        bg.set_wrapping_enabled(false);
+
+        bn::unique_ptr<bn::affine_bg_perspective_plane> plane(
+                    new bn::affine_bg_perspective_plane(bn::move(bg), 32));
+        bn::core::update();
+        plane->update();
+
+        // The plane reserves its own channel, so the bn::hdma ones are kept free:
+        #if BN_CFG_HDMA_MAX_CHANNELS > 2
+            BN_ASSERT(! bn::hdma::running(), "Low priority channel is used");
+        #endif
+
+        BN_ASSERT(! bn::hdma::high_priority_running(), "High priority channel is used");
+
+        bn::timer timer;
+
+        for(int index = 0; index < updates; ++index)
+        {
+            plane->set_camera_yaw(index % 360);
+            plane->update();
+        }
+
+        int ticks = timer.elapsed_ticks();
+        BN_LOG("perspective plane update cycles: ", int((int64_t(ticks) * bn::timers::cpu_clocks_per_tick()) / updates));
+
+        plane.reset();
+        bn::core::update();
+        BN_ASSERT(! bn::hdma::running() && ! bn::hdma::high_priority_running(), "HDMA is still running");
+    }
+
+private:
+    static constexpr bn::color colors[16] = {};
+    static constexpr int updates = 64;
+};
+
+#endif
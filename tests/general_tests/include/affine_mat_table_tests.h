@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef AFFINE_MAT_TABLE_TESTS_H
+#define AFFINE_MAT_TABLE_TESTS_H
+
+#include "bn_timer.h"
+#include "bn_timers.h"
+#include "bn_affine_mat_table.h"
+#include "bn_sprite_affine_mat_ptr.h"
+#include "tests.h"
+
+class affine_mat_table_tests : public tests
+{
+
+public:
+    affine_mat_table_tests() :
+        tests("affine_mat_table")
+    {
+        bn::sprite_affine_mat_ptr affine_mat = bn::sprite_affine_mat_ptr::create();
+
+        // Runtime path: sines, cosines and register values are calculated for each update:
+        bn::timer timer;
+
+        for(int index = 0; index < updates; ++index)
+        {
+            int rotation_index = index % table_type::rotation_steps();
+            int scale_index = (index / table_type::rotation_steps()) % table_type::scale_steps();
+            affine_mat.set_rotation_angle(table.rotation_angle(rotation_index));
+            affine_mat.set_scale(table.scale(scale_index));
+        }
+
+        int runtime_ticks = timer.elapsed_ticks();
+        timer.restart();
+
+        // Table path: precalculated attributes are copied:
+        for(int index = 0; index < updates; ++index)
+        {
+            int rotation_index = index % table_type::rotation_steps();
+            int scale_index = (index / table_type::rotation_steps()) % table_type::scale_steps();
+            affine_mat.set_attributes(table.attributes(rotation_index, scale_index));
+        }
+
+        int table_ticks = timer.elapsed_ticks();
+
+        for(int rotation_index = 0; rotation_index < table_type::rotation_steps(); ++rotation_index)
+        {
+            for(int scale_index = 0; scale_index < table_type::scale_steps(); ++scale_index)
+            {
+                bn::affine_mat_attributes attributes;
+                attributes.set_rotation_angle(table.rotation_angle(rotation_index));
+                attributes.set_scale(table.scale(scale_index));
+                BN_ASSERT(attributes == table.attributes(rotation_index, scale_index),
+                          "Invalid attributes: ", rotation_index, " - ", scale_index);
+            }
+        }
+
+        BN_LOG("affine mat update cycles: ", _cycles_per_update(runtime_ticks),
+               " (table: ", _cycles_per_update(table_ticks), ')');
+    }
+
+private:
+    using table_type = bn::affine_mat_table<64, 4>;
+
+    static constexpr table_type table = table_type(bn::fixed(0.5), 2);
+    static constexpr int updates = 1024;
+
+    [[nodiscard]] static int _cycles_per_update(int ticks)
+    {
+        return int((int64_t(ticks) * bn::timers::cpu_clocks_per_tick()) / updates);
+    }
+};
+
+#endif
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef BEST_FIT_ALLOCATOR_TESTS_H
+#define BEST_FIT_ALLOCATOR_TESTS_H
+
+#include "bn_timer.h"
+#include "bn_timers.h"
+#include "bn_cstdlib.h"
+#include "bn_best_fit_allocator.h"
+#include "tests.h"
+
+class best_fit_allocator_tests : public tests
+{
+
+public:
+    best_fit_allocator_tests() :
+        tests("best_fit_allocator")
+    {
+        void* buffer = bn::malloc(buffer_bytes);
+        BN_ASSERT(buffer);
+
+        bn::best_fit_allocator allocator(buffer, buffer_bytes);
+        void* ptrs[ptrs_count];
+
+        // Fragmented workload: small items of different sizes with every other one freed:
+        for(int index = 0; index < ptrs_count; ++index)
+        {
+            ptrs[index] = allocator.alloc(_bytes(index));
+            BN_ASSERT(ptrs[index], "Alloc failed: ", index);
+        }
+
+        for(int index = 0; index < ptrs_count; index += 2)
+        {
+            allocator.free(ptrs[index]);
+            ptrs[index] = nullptr;
+        }
+
+        bn::timer timer;
+
+        for(int cycle = 0; cycle < cycles; ++cycle)
+        {
+            for(int index = 0; index < ptrs_count; index += 2)
+            {
+                ptrs[index] = allocator.alloc(_bytes(index + cycle));
+                BN_ASSERT(ptrs[index], "Alloc failed: ", cycle, " - ", index);
+            }
+
+            for(int index = 0; index < ptrs_count; index += 2)
+            {
+                allocator.free(ptrs[index]);
+                ptrs[index] = nullptr;
+            }
+        }
+
+        int ticks = timer.elapsed_ticks();
+        int operations = cycles * ptrs_count;
+        BN_LOG("alloc/free cycles per operation: ",
+               int((int64_t(ticks) * bn::timers::cpu_clocks_per_tick()) / operations));
+
+        for(int index = 1; index < ptrs_count; index += 2)
+        {
+            allocator.free(ptrs[index]);
+        }
+
+        BN_ASSERT(allocator.empty());
+        bn::free(buffer);
+    }
+
+private:
+    static constexpr int buffer_bytes = 64 * 1024;
+    static constexpr int ptrs_count = 512;
+    static constexpr int cycles = 8;
+
+    [[nodiscard]] static int _bytes(int index)
+    {
+        return 4 + ((index * 13) % 48);
+    }
+};
+
+#endif
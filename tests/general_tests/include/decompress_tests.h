@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef DECOMPRESS_TESTS_H
+#define DECOMPRESS_TESTS_H
+
+#include "bn_timer.h"
+#include "bn_timers.h"
+#include "bn_memory.h"
+#include "bn_cstdlib.h"
+#include "bn_sprite_tiles_ptr.h"
+#include "tests.h"
+
+#include "bn_sprite_tiles_items_decompress_lz4.h"
+#include "bn_sprite_tiles_items_decompress_none.h"
+#include "bn_sprite_tiles_items_decompress_lz77.h"
+#include "bn_sprite_tiles_items_decompress_huffman.h"
+#include "bn_sprite_tiles_items_decompress_run_length.h"
+
+class decompress_tests : public tests
+{
+
+public:
+    decompress_tests() :
+        tests("decompress")
+    {
+        const bn::sprite_tiles_item& none_item = bn::sprite_tiles_items::decompress_none;
+        bn::span<const bn::tile> expected_tiles = none_item.tiles_ref();
+        int tiles_count = expected_tiles.size();
+
+        auto ewram_tiles = static_cast<bn::tile*>(bn::malloc(tiles_count * int(sizeof(bn::tile))));
+        BN_ASSERT(ewram_tiles);
+
+        bn::sprite_tiles_ptr vram_tiles_ptr = bn::sprite_tiles_ptr::allocate(tiles_count, bn::bpp_mode::BPP_4);
+        bn::tile* vram_tiles = vram_tiles_ptr.vram()->data();
+
+        const bn::tile* none_tiles = expected_tiles.data();
+        const bn::tile* lz77_tiles = bn::sprite_tiles_items::decompress_lz77.tiles_ref().data();
+        const bn::tile* rl_tiles = bn::sprite_tiles_items::decompress_run_length.tiles_ref().data();
+        const bn::tile* huffman_tiles = bn::sprite_tiles_items::decompress_huffman.tiles_ref().data();
+        const bn::tile* lz4_tiles = bn::sprite_tiles_items::decompress_lz4.tiles_ref().data();
+
+        _benchmark("none_wram", none_tiles, bn::compression_type::NONE, expected_tiles, ewram_tiles);
+        _benchmark("none_vram", none_tiles, bn::compression_type::NONE, expected_tiles, vram_tiles);
+        _benchmark("lz77_wram", lz77_tiles, bn::compression_type::LZ77, expected_tiles, ewram_tiles);
+        _benchmark("lz77_vram", lz77_tiles, bn::compression_type::LZ77, expected_tiles, vram_tiles);
+        _benchmark("rl_wram", rl_tiles, bn::compression_type::RUN_LENGTH, expected_tiles, ewram_tiles);
+        _benchmark("rl_vram", rl_tiles, bn::compression_type::RUN_LENGTH, expected_tiles, vram_tiles);
+        _benchmark("huffman_wram", huffman_tiles, bn::compression_type::HUFFMAN, expected_tiles, ewram_tiles);
+        _benchmark("huffman_vram", huffman_tiles, bn::compression_type::HUFFMAN, expected_tiles, vram_tiles);
+        _benchmark("lz4_wram", lz4_tiles, bn::compression_type::LZ4, expected_tiles, ewram_tiles);
+        _benchmark("lz4_vram", lz4_tiles, bn::compression_type::LZ4, expected_tiles, vram_tiles);
+
+        bn::free(ewram_tiles);
+    }
+
+private:
+    static void _benchmark(const char* id, const bn::tile* source_tiles, bn::compression_type compression,
+                           const bn::span<const bn::tile>& expected_tiles, bn::tile* destination_tiles)
+    {
+        int bytes = expected_tiles.size_bytes();
+
+        bn::memory::clear(expected_tiles.size(), *destination_tiles);
+
+        bn::timer timer;
+        bn::memory::decompress(compression, source_tiles, bytes, destination_tiles);
+
+        int ticks = timer.elapsed_ticks();
+        _check(id, expected_tiles, destination_tiles);
+
+        BN_LOG(id, " cycles per KB: ", _cycles_per_kb(ticks, bytes));
+    }
+
+    static void _check(const char* id, const bn::span<const bn::tile>& expected_tiles,
+                       const bn::tile* destination_tiles)
+    {
+        for(int index = 0, limit = expected_tiles.size(); index < limit; ++index)
+        {
+            const bn::tile& expected_tile = expected_tiles[index];
+            const bn::tile& destination_tile = destination_tiles[index];
+
+            for(int word_index = 0; word_index < 8; ++word_index)
+            {
+                BN_ASSERT(expected_tile.data[word_index] == destination_tile.data[word_index],
+                          "Invalid tile: ", id, " - ", index, " - ", word_index);
+            }
+        }
+    }
+
+    [[nodiscard]] static int _cycles_per_kb(int ticks, int bytes)
+    {
+        return int((int64_t(ticks) * bn::timers::cpu_clocks_per_tick() * 1024) / bytes);
+    }
+};
+
+#endif
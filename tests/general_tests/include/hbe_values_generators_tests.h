@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef HBE_VALUES_GENERATORS_TESTS_H
+#define HBE_VALUES_GENERATORS_TESTS_H
+
+#include "bn_math.h"
+#include "bn_hbe_values_generators.h"
+#include "tests.h"
+
+class hbe_values_generators_tests : public tests
+{
+
+public:
+    hbe_values_generators_tests() :
+        tests("hbe_values_generators")
+    {
+        _test_sine_wave(64, 3, 10);
+        _test_sine_wave(32, fixed(0.5), 270);
+        _test_sine_wave(8, 11, 0);
+
+        _test_linear_gradient(-8, 24);
+        _test_linear_gradient(100, fixed(-0.5));
+
+        _test_keyframes();
+    }
+
+private:
+    using fixed = bn::fixed;
+
+    // The sine recurrence must not drift from bn::degrees_sin after 160 lines:
+    static void _test_sine_wave(fixed amplitude, fixed degrees_step, fixed degrees_phase)
+    {
+        bn::sine_wave_hbe_values generator(amplitude, degrees_step, degrees_phase);
+        bn::span<const fixed> values = generator.values();
+
+        for(int index = 0; index < values.size(); ++index)
+        {
+            fixed degrees = degrees_phase + (degrees_step * index);
+
+            while(degrees >= 360)
+            {
+                degrees -= 360;
+            }
+
+            fixed expected = amplitude.safe_multiplication(bn::degrees_sin(degrees));
+            _check_value("sine", values[index], expected, index, fixed(1) / 16);
+        }
+    }
+
+    static void _test_linear_gradient(fixed first_value, fixed last_value)
+    {
+        bn::linear_gradient_hbe_values generator(first_value, last_value);
+        bn::span<const fixed> values = generator.values();
+        int last_index = values.size() - 1;
+        BN_ASSERT(values[0] == first_value, "Invalid first value: ", values[0], " - ", first_value);
+        BN_ASSERT(values[last_index] == last_value, "Invalid last value: ", values[last_index], " - ", last_value);
+
+        for(int index = 1; index <= last_index; ++index)
+        {
+            fixed expected = first_value + (((last_value - first_value) * index) / last_index);
+            _check_value("gradient", values[index], expected, index, fixed(1) / 256);
+        }
+    }
+
+    static void _test_keyframes()
+    {
+        constexpr bn::hbe_keyframe keyframes[] = {
+            bn::hbe_keyframe(10, 0),
+            bn::hbe_keyframe(50, 40),
+            bn::hbe_keyframe(100, -10),
+        };
+
+        bn::keyframes_hbe_values generator(keyframes);
+        bn::span<const fixed> values = generator.values();
+
+        for(int index = 0; index < values.size(); ++index)
+        {
+            fixed expected;
+
+            if(index <= 10)
+            {
+                expected = 0;
+            }
+            else if(index <= 50)
+            {
+                expected = index - 10;
+            }
+            else if(index <= 100)
+            {
+                expected = 40 - (index - 50);
+            }
+            else
+            {
+                expected = -10;
+            }
+
+            _check_value("keyframes", values[index], expected, index, fixed(1) / 256);
+        }
+    }
+
+    static void _check_value(const char* id, fixed value, fixed expected, int line, fixed tolerance)
+    {
+        BN_ASSERT(bn::abs(value - expected) <= tolerance,
+                  "Invalid ", id, " value: ", line, " - ", value, " - ", expected);
+    }
+};
+
+#endif
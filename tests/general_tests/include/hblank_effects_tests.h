@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef HBLANK_EFFECTS_TESTS_H
+#define HBLANK_EFFECTS_TESTS_H
+
+#include "bn_core.h"
+#include "bn_colors.h"
+#include "bn_display.h"
+#include "bn_bg_palette_ptr.h"
+#include "bn_bg_palette_item.h"
+#include "bn_bg_palette_color_hbe_ptr.h"
+#include "tests.h"
+
+class hblank_effects_tests : public tests
+{
+
+public:
+    hblank_effects_tests() :
+        tests("hblank_effects")
+    {
+        // Only three lines change, so with BN_CFG_HBES_SPARSE_MAX_LINES enabled they are written in sparse mode:
+        bn::color colors[bn::display::height()];
+
+        for(int index = 0; index < bn::display::height(); ++index)
+        {
+            colors[index] = index < 40 ? bn::colors::red : index < 100 ? bn::colors::green : bn::colors::blue;
+        }
+
+        bn::color palette_colors[16];
+        bn::bg_palette_item palette_item(palette_colors, bn::bpp_mode::BPP_4);
+        bn::bg_palette_ptr palette = bn::bg_palette_ptr::create(palette_item);
+        bn::bg_palette_color_hbe_ptr hbe = bn::bg_palette_color_hbe_ptr::create(palette, 1, colors);
+        bn::core::update();
+        bn::core::update();
+
+        for(int frame = 0; frame < 4; ++frame)
+        {
+            _check_line(palette, colors, 20);
+            _check_line(palette, colors, 70);
+            _check_line(palette, colors, 130);
+        }
+    }
+
+private:
+    static void _check_line(const bn::bg_palette_ptr& palette, const bn::color* colors, int line)
+    {
+        auto vcount = reinterpret_cast<const volatile uint16_t*>(0x04000006);
+
+        while(*vcount != line)
+        {
+        }
+
+        // Neighbour lines have the same color, so it doesn't matter if the line's H-Blank has been reached or not:
+        auto palette_ram = reinterpret_cast<const volatile uint16_t*>(0x05000000);
+        int color = palette_ram[(palette.id() * 16) + 1];
+        BN_ASSERT(color == colors[line].data(), "Invalid color: ", line, " - ", color, " - ", colors[line].data());
+    }
+};
+
+#endif
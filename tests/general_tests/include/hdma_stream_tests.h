@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef HDMA_STREAM_TESTS_H
+#define HDMA_STREAM_TESTS_H
+
+#include "bn_core.h"
+#include "bn_hdma.h"
+#include "bn_unique_ptr.h"
+#include "bn_hdma_stream.h"
+#include "bn_config_hdma.h"
+#include "tests.h"
+
+class hdma_stream_tests : public tests
+{
+
+public:
+    hdma_stream_tests() :
+        tests("hdma_stream")
+    {
+        bn::unique_ptr<scroll_stream_type> scroll_stream(new scroll_stream_type(scroll_destination));
+        bn::unique_ptr<color_stream_type> color_stream(new color_stream_type(color_destination));
+        BN_ASSERT(bn::hdma::running() || bn::hdma::high_priority_running(), "Channels are not reserved");
+
+        #if BN_CFG_HDMA_MAX_CHANNELS > 2
+            BN_ASSERT(! scroll_stream->high_priority(), "Scroll stream uses the high priority channel");
+            BN_ASSERT(! color_stream->high_priority(), "Color stream uses the high priority channel");
+        #endif
+
+        bn::span<uint32_t> first_table = scroll_stream->next_table();
+        first_table[0] = 1;
+        scroll_stream->publish();
+        BN_ASSERT(scroll_stream->running(), "Scroll stream is not running");
+
+        // The pending table can be written again until it is committed:
+        BN_ASSERT(scroll_stream->next_table().data() == first_table.data(), "Invalid pending table");
+        scroll_stream->publish();
+        bn::core::update();
+
+        // The committed table can't be written:
+        bn::span<uint32_t> second_table = scroll_stream->next_table();
+        BN_ASSERT(second_table.data() != first_table.data(), "Committed table returned");
+
+        color_stream->next_table()[0] = 0;
+        color_stream->publish();
+
+        bn::span<uint16_t> color_table = color_stream->next_table();
+        color_stream->publish();
+
+        // With three tables, pending tables are not returned:
+        BN_ASSERT(color_stream->next_table().data() != color_table.data(), "Pending table returned");
+
+        scroll_stream->stop();
+        BN_ASSERT(! scroll_stream->running(), "Scroll stream is still running");
+
+        scroll_stream.reset();
+        color_stream.reset();
+        BN_ASSERT(! bn::hdma::running() && ! bn::hdma::high_priority_running(), "Channels are still reserved");
+    }
+
+private:
+    using scroll_stream_type = bn::hdma_stream<uint32_t, 1>;
+    using color_stream_type = bn::hdma_stream<uint16_t, 1, 3>;
+
+    static inline uint32_t scroll_destination = 0;
+    static inline uint16_t color_destination = 0;
+};
+
+#endif
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef PARTICLE_SYSTEM_TESTS_H
+#define PARTICLE_SYSTEM_TESTS_H
+
+#include "bn_core.h"
+#include "bn_display.h"
+#include "bn_sprite_ptr.h"
+#include "bn_particle_system.h"
+#include "tests.h"
+
+#include "bn_sprite_items_common_fixed_8x8_font.h"
+
+class particle_system_tests : public tests
+{
+
+public:
+    particle_system_tests() :
+        tests("particle_system")
+    {
+        const bn::sprite_item& sprite_item = bn::sprite_items::common_fixed_8x8_font;
+        bn::sprite_ptr sprite = bn::sprite_ptr::create(0, 0, sprite_item);
+        bn::particle_system<4> first_system(sprite_item);
+        bn::particle_system<4> second_system(sprite_item);
+        first_system.emit(bn::fixed_point(0, 0), bn::fixed_point(1, 0), 60);
+        second_system.emit(bn::fixed_point(0, 16), bn::fixed_point(0, 0), 60);
+
+        // Sprite handles are rebuilt in each frame, so reserved handles must be committed anyway:
+        for(int frame = 1; frame <= 4; ++frame)
+        {
+            sprite.set_visible(! sprite.visible());
+            first_system.update();
+            second_system.update();
+            bn::core::update();
+
+            int x = _oam_x(first_system.first_hw_id());
+            BN_ASSERT(x == frame + _x_offset, "Invalid particle x: ", x, " - ", frame);
+            BN_ASSERT(_oam_visible(second_system.first_hw_id()), "Second system particle not visible");
+        }
+
+        // Creating or destroying a particle system doesn't hide the particles of the other ones:
+        {
+            bn::particle_system<4> third_system(sprite_item);
+            bn::core::update();
+            BN_ASSERT(_oam_visible(first_system.first_hw_id()), "First system particle hidden on creation");
+            BN_ASSERT(_oam_visible(second_system.first_hw_id()), "Second system particle hidden on creation");
+        }
+
+        bn::core::update();
+        BN_ASSERT(_oam_visible(first_system.first_hw_id()), "First system particle hidden on destruction");
+        BN_ASSERT(_oam_visible(second_system.first_hw_id()), "Second system particle hidden on destruction");
+
+        first_system.clear();
+        second_system.clear();
+        first_system.update();
+        second_system.update();
+        bn::core::update();
+        BN_ASSERT(! _oam_visible(first_system.first_hw_id()), "First system particle not hidden");
+        BN_ASSERT(! _oam_visible(second_system.first_hw_id()), "Second system particle not hidden");
+    }
+
+private:
+    static constexpr int _x_offset = (bn::display::width() - 8) / 2;
+
+    [[nodiscard]] static const volatile uint16_t* _oam_entry(int hw_id)
+    {
+        return reinterpret_cast<const volatile uint16_t*>(0x07000000) + (hw_id * 4);
+    }
+
+    [[nodiscard]] static int _oam_x(int hw_id)
+    {
+        return _oam_entry(hw_id)[1] & 511;
+    }
+
+    [[nodiscard]] static bool _oam_visible(int hw_id)
+    {
+        return (_oam_entry(hw_id)[0] & 0x0300) != 0x0200;
+    }
+};
+
+#endif
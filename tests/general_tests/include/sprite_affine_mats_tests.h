@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef SPRITE_AFFINE_MATS_TESTS_H
+#define SPRITE_AFFINE_MATS_TESTS_H
+
+#include "bn_sprite_ptr.h"
+#include "bn_affine_mat_attributes.h"
+#include "bn_sprite_affine_mat_ptr.h"
+#include "tests.h"
+
+#include "common_variable_8x16_sprite_font.h"
+
+class sprite_affine_mats_tests : public tests
+{
+
+public:
+    sprite_affine_mats_tests() :
+        tests("sprite_affine_mats")
+    {
+        const bn::sprite_item& sprite_item = common::variable_8x16_sprite_font.item();
+        bn::affine_mat_attributes attributes;
+        attributes.set_rotation_angle(45);
+
+        // Private matrices are not shared:
+        bn::sprite_ptr private_sprite = bn::sprite_ptr::create(0, 0, sprite_item);
+        private_sprite.set_rotation_angle(45);
+        bn::sprite_affine_mat_ptr private_affine_mat = bn::sprite_affine_mat_ptr::create(attributes);
+        BN_ASSERT(! bn::sprite_affine_mat_ptr::find(attributes), "Private matrix found");
+
+        // Shared matrices are:
+        bn::sprite_affine_mat_ptr shared_affine_mat = bn::sprite_affine_mat_ptr::find_or_create(attributes);
+        BN_ASSERT(shared_affine_mat != *private_sprite.affine_mat(), "Private sprite matrix shared");
+        BN_ASSERT(shared_affine_mat != private_affine_mat, "Private matrix shared");
+
+        bn::sprite_ptr first_sprite = bn::sprite_ptr::create(0, 0, sprite_item);
+        first_sprite.set_affine_mat(shared_affine_mat);
+
+        bn::sprite_ptr second_sprite = bn::sprite_ptr::create(0, 0, sprite_item);
+        second_sprite.set_affine_mat(bn::sprite_affine_mat_ptr::find_or_create(attributes));
+        BN_ASSERT(*first_sprite.affine_mat() == *second_sprite.affine_mat(), "Matrix not shared");
+
+        // Changing a private matrix after sharing doesn't change the shared one:
+        private_sprite.set_rotation_angle(90);
+        private_affine_mat.set_rotation_angle(90);
+        BN_ASSERT(first_sprite.rotation_angle() == 45, "Invalid first sprite rotation angle: ",
+                  first_sprite.rotation_angle());
+        BN_ASSERT(second_sprite.rotation_angle() == 45, "Invalid second sprite rotation angle: ",
+                  second_sprite.rotation_angle());
+        BN_ASSERT(! bn::sprite_affine_mat_ptr::find(private_affine_mat.attributes()), "Private matrix found");
+
+        // Sprite setters replace shared matrices with private copies:
+        second_sprite.set_rotation_angle(90);
+        second_sprite.set_horizontal_flip(true);
+        BN_ASSERT(*first_sprite.affine_mat() == shared_affine_mat, "Shared matrix replaced");
+        BN_ASSERT(*second_sprite.affine_mat() != shared_affine_mat, "Shared matrix not replaced");
+        BN_ASSERT(! second_sprite.affine_mat()->shared(), "Private sprite matrix shared");
+        BN_ASSERT(shared_affine_mat.shared(), "Shared matrix not shared");
+        BN_ASSERT(first_sprite.rotation_angle() == 45, "Invalid first sprite rotation angle: ",
+                  first_sprite.rotation_angle());
+        BN_ASSERT(! first_sprite.horizontal_flip(), "Invalid first sprite horizontal flip");
+        BN_ASSERT(second_sprite.rotation_angle() == 90, "Invalid second sprite rotation angle: ",
+                  second_sprite.rotation_angle());
+        BN_ASSERT(second_sprite.horizontal_flip(), "Invalid second sprite horizontal flip");
+    }
+};
+
+#endif
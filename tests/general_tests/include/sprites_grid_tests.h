@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef SPRITES_GRID_TESTS_H
+#define SPRITES_GRID_TESTS_H
+
+#include "bn_core.h"
+#include "bn_display.h"
+#include "bn_camera_ptr.h"
+#include "bn_sprite_ptr.h"
+#include "bn_config_sprites.h"
+#include "bn_sprite_tiles_ptr.h"
+#include "tests.h"
+
+#include "bn_sprite_items_common_fixed_8x8_font.h"
+
+class sprites_grid_tests : public tests
+{
+
+public:
+    sprites_grid_tests() :
+        tests("sprites_grid")
+    {
+        bn::camera_ptr camera = bn::camera_ptr::create(0, 0);
+        bn::sprite_ptr origin_sprite = _create_sprite(camera, 0, 0, 1);
+        bn::sprite_ptr far_sprite = _create_sprite(camera, 600, 16, 2);
+        bn::sprite_ptr negative_sprite = _create_sprite(camera, -400, -16, 3);
+
+        // With 16 columns, a sprite one grid width away shares the cell of the origin sprite:
+        constexpr int wrap_x = BN_CFG_SPRITES_GRID_CELL_SIZE ? BN_CFG_SPRITES_GRID_CELL_SIZE * 16 : 1024;
+        bn::sprite_ptr wrapped_sprite = _create_sprite(camera, wrap_x, 32, 4);
+
+        bn::core::update();
+        _check_visible(camera, origin_sprite, "origin");
+        _check_hidden(far_sprite, "far");
+        _check_hidden(negative_sprite, "negative");
+        _check_hidden(wrapped_sprite, "wrapped");
+
+        // Move the camera in small steps, so sprites enter and leave the screen while their cells are skipped:
+        for(int x = 0; x <= 600; x += 8)
+        {
+            camera.set_x(x);
+            bn::core::update();
+        }
+
+        _check_hidden(origin_sprite, "origin");
+        _check_visible(camera, far_sprite, "far");
+        _check_hidden(negative_sprite, "negative");
+        _check_hidden(wrapped_sprite, "wrapped");
+
+        // Sprites moved while their cells are skipped must be updated when the camera reaches them:
+        origin_sprite.set_position(8, 8);
+
+        // Jump to the other side of the grid:
+        camera.set_position(-400, -16);
+        bn::core::update();
+        _check_hidden(origin_sprite, "origin");
+        _check_hidden(far_sprite, "far");
+        _check_visible(camera, negative_sprite, "negative");
+        _check_hidden(wrapped_sprite, "wrapped");
+
+        // The origin and wrapped sprites share cells, but only the ones near the camera must be shown:
+        camera.set_position(wrap_x, 32);
+        bn::core::update();
+        _check_hidden(origin_sprite, "origin");
+        _check_hidden(far_sprite, "far");
+        _check_hidden(negative_sprite, "negative");
+        _check_visible(camera, wrapped_sprite, "wrapped");
+
+        camera.set_position(0, 0);
+        bn::core::update();
+        _check_visible(camera, origin_sprite, "origin");
+        _check_hidden(far_sprite, "far");
+        _check_hidden(negative_sprite, "negative");
+        _check_hidden(wrapped_sprite, "wrapped");
+    }
+
+private:
+    [[nodiscard]] static bn::sprite_ptr _create_sprite(const bn::camera_ptr& camera, int x, int y,
+                                                      int graphics_index)
+    {
+        bn::sprite_ptr result = bn::sprite_ptr::create(x, y, bn::sprite_items::common_fixed_8x8_font,
+                                                       graphics_index);
+        result.set_bg_priority(0);
+        result.set_camera(camera);
+        return result;
+    }
+
+    [[nodiscard]] static const volatile uint16_t* _oam_entry(const bn::sprite_ptr& sprite)
+    {
+        auto oam = reinterpret_cast<const volatile uint16_t*>(0x07000000);
+        int tile_id = sprite.tiles().id();
+
+        for(int index = 0; index < 128; ++index)
+        {
+            const volatile uint16_t* entry = oam + (index * 4);
+
+            if((entry[0] & 0x0300) != 0x0200 && (entry[2] & 1023) == tile_id)
+            {
+                return entry;
+            }
+        }
+
+        return nullptr;
+    }
+
+    static void _check_visible(const bn::camera_ptr& camera, const bn::sprite_ptr& sprite, const char* id)
+    {
+        const volatile uint16_t* entry = _oam_entry(sprite);
+        BN_ASSERT(entry, "Sprite not visible: ", id);
+
+        int expected_x = (sprite.x() - camera.x()).right_shift_integer() + (bn::display::width() / 2) - 4;
+        int expected_y = (sprite.y() - camera.y()).right_shift_integer() + (bn::display::height() / 2) - 4;
+        int x = entry[1] & 511;
+        int y = entry[0] & 255;
+        BN_ASSERT(x == (expected_x & 511), "Invalid sprite x: ", id, " - ", x, " - ", expected_x);
+        BN_ASSERT(y == (expected_y & 255), "Invalid sprite y: ", id, " - ", y, " - ", expected_y);
+    }
+
+    static void _check_hidden(const bn::sprite_ptr& sprite, const char* id)
+    {
+        BN_ASSERT(! _oam_entry(sprite), "Sprite not hidden: ", id);
+    }
+};
+
+#endif
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2020-2022 Gustavo Valiente gustavo.valiente@protonmail.com
+ * zlib License, see LICENSE file.
+ */
+
+#ifndef SPRITES_TESTS_H
+#define SPRITES_TESTS_H
+
+#include "bn_core.h"
+#include "bn_span.h"
+#include "bn_vector.h"
+#include "bn_display.h"
+#include "bn_sprites.h"
+#include "bn_camera_ptr.h"
+#include "bn_sprite_ptr.h"
+#include "bn_fixed_point.h"
+#include "bn_sprite_tiles_ptr.h"
+#include "tests.h"
+
+#include "bn_sprite_items_common_fixed_8x8_font.h"
+
+class sprites_tests : public tests
+{
+
+public:
+    sprites_tests() :
+        tests("sprites")
+    {
+        _test_removal(false);
+        _test_removal(true);
+
+        _benchmark("no_camera", mode::NO_CAMERA);
+        _benchmark("camera", mode::CAMERA);
+        _benchmark("batch", mode::BATCH);
+    }
+
+private:
+    enum class mode
+    {
+        NO_CAMERA,
+        CAMERA,
+        BATCH
+    };
+
+    static constexpr int removal_sprites_count = 16;
+    static constexpr int sprites_count = 128;
+    static constexpr int frames = 64;
+    static constexpr int checked_sprite_index = 32;
+
+    // Destroyed sprites are swap-removed from the hot items array, so the remaining ones must be kept intact:
+    static void _test_removal(bool use_camera)
+    {
+        bn::optional<bn::camera_ptr> camera;
+
+        if(use_camera)
+        {
+            camera = bn::camera_ptr::create(0, 0);
+        }
+
+        bn::vector<bn::sprite_ptr, removal_sprites_count> sprites;
+
+        for(int index = 0; index < removal_sprites_count; ++index)
+        {
+            bn::sprite_ptr sprite = bn::sprite_ptr::create(((index % 8) * 24) - 84, ((index / 8) * 24) - 12,
+                                                           bn::sprite_items::common_fixed_8x8_font, index + 1);
+            sprite.set_bg_priority(0);
+            sprite.set_camera(camera);
+            sprites.push_back(bn::move(sprite));
+        }
+
+        bn::core::update();
+
+        for(const bn::sprite_ptr& sprite : sprites)
+        {
+            _check_visible(camera, sprite);
+        }
+
+        // Remove the first, a middle and the last sprites:
+        bn::vector<int, 3> removed_tile_ids;
+        removed_tile_ids.push_back(sprites.front().tiles().id());
+        sprites.erase(sprites.begin());
+        removed_tile_ids.push_back(sprites[6].tiles().id());
+        sprites.erase(sprites.begin() + 6);
+        removed_tile_ids.push_back(sprites.back().tiles().id());
+        sprites.pop_back();
+
+        for(bn::sprite_ptr& sprite : sprites)
+        {
+            sprite.set_position(sprite.x() + 4, sprite.y() - 2);
+        }
+
+        if(camera)
+        {
+            camera->set_position(8, 4);
+        }
+
+        bn::core::update();
+
+        for(const bn::sprite_ptr& sprite : sprites)
+        {
+            _check_visible(camera, sprite);
+        }
+
+        for(int removed_tile_id : removed_tile_ids)
+        {
+            BN_ASSERT(! _oam_entry(removed_tile_id), "Removed sprite is visible: ", removed_tile_id);
+        }
+
+        // Hidden sprites must be removed from OAM too:
+        sprites[2].set_visible(false);
+        bn::core::update();
+        BN_ASSERT(! _oam_entry(sprites[2].tiles().id()), "Hidden sprite is visible");
+        _check_visible(camera, sprites[3]);
+    }
+
+    static void _benchmark(const char* id, mode benchmark_mode)
+    {
+        const bn::sprite_item& sprite_item = bn::sprite_items::common_fixed_8x8_font;
+        bn::vector<bn::sprite_ptr, sprites_count> sprites;
+        bn::optional<bn::camera_ptr> camera;
+
+        if(benchmark_mode == mode::CAMERA)
+        {
+            camera = bn::camera_ptr::create(0, 0);
+        }
+
+        // Sprites are spread in a band wider than the screen, so some of them are always outside of it:
+        for(int index = 0; index < sprites_count; ++index)
+        {
+            int graphics_index = index == checked_sprite_index ? 1 : 0;
+            bn::sprite_ptr sprite = bn::sprite_ptr::create(_x(index), _y(index), sprite_item, graphics_index);
+            sprite.set_camera(camera);
+            sprites.push_back(bn::move(sprite));
+        }
+
+        bn::core::update();
+
+        bn::fixed_point deltas[sprites_count];
+
+        for(bn::fixed_point& delta : deltas)
+        {
+            delta = bn::fixed_point(2, 0);
+        }
+
+        bn::fixed cpu_usage;
+
+        for(int frame = 1; frame <= frames; ++frame)
+        {
+            if(camera)
+            {
+                camera->set_x(-frame * 2);
+            }
+            else if(benchmark_mode == mode::BATCH)
+            {
+                bn::sprites::add_positions(bn::span<bn::sprite_ptr>(sprites.data(), sprites_count), deltas);
+            }
+            else
+            {
+                for(int index = 0; index < sprites_count; ++index)
+                {
+                    sprites[index].set_x(_x(index) + (frame * 2));
+                }
+            }
+
+            bn::core::update();
+            cpu_usage += bn::core::last_cpu_usage();
+        }
+
+        int x = _x(checked_sprite_index) + (frames * 2) + (bn::display::width() / 2) - 4;
+        const volatile uint16_t* entry = _oam_entry(sprites[checked_sprite_index].tiles().id());
+        BN_ASSERT(entry, "Sprite not visible: ", id);
+        BN_ASSERT((entry[1] & 511) == (x & 511), "Invalid sprite x: ", id, " - ", entry[1] & 511, " - ", x);
+
+        BN_LOG(id, " CPU usage per frame: ", cpu_usage / frames);
+    }
+
+    [[nodiscard]] static int _x(int index)
+    {
+        return (index * 4) - 256;
+    }
+
+    [[nodiscard]] static int _y(int index)
+    {
+        return ((index * 7) % 144) - 72;
+    }
+
+    [[nodiscard]] static const volatile uint16_t* _oam_entry(int tile_id)
+    {
+        auto oam = reinterpret_cast<const volatile uint16_t*>(0x07000000);
+
+        for(int index = 0; index < 128; ++index)
+        {
+            const volatile uint16_t* entry = oam + (index * 4);
+
+            if((entry[0] & 0x0300) != 0x0200 && (entry[2] & 1023) == tile_id)
+            {
+                return entry;
+            }
+        }
+
+        return nullptr;
+    }
+
+    static void _check_visible(const bn::optional<bn::camera_ptr>& camera, const bn::sprite_ptr& sprite)
+    {
+        int tile_id = sprite.tiles().id();
+        const volatile uint16_t* entry = _oam_entry(tile_id);
+        BN_ASSERT(entry, "Sprite not visible: ", tile_id);
+
+        bn::fixed_point position = sprite.position();
+
+        if(camera)
+        {
+            position -= camera->position();
+        }
+
+        int expected_x = position.x().right_shift_integer() + (bn::display::width() / 2) - 4;
+        int expected_y = position.y().right_shift_integer() + (bn::display::height() / 2) - 4;
+        int x = entry[1] & 511;
+        int y = entry[0] & 255;
+        BN_ASSERT(x == (expected_x & 511), "Invalid sprite x: ", tile_id, " - ", x, " - ", expected_x);
+        BN_ASSERT(y == (expected_y & 255), "Invalid sprite y: ", tile_id, " - ", y, " - ", expected_y);
+    }
+};
+
+#endif
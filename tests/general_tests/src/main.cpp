@@ -21,6 +21,17 @@
 #include "format_tests.h"
 #include "memory_tests.h"
 #include "sram_tests.h"
+#include "decompress_tests.h"
+#include "best_fit_allocator_tests.h"
+#include "sprites_tests.h"
+#include "sprites_grid_tests.h"
+#include "particle_system_tests.h"
+#include "sprite_affine_mats_tests.h"
+#include "affine_mat_table_tests.h"
+#include "affine_bg_perspective_plane_tests.h"
+#include "hdma_stream_tests.h"
+#include "hblank_effects_tests.h"
+#include "hbe_values_generators_tests.h"
 
 #if ! BN_CFG_ASSERT_ENABLED
     static_assert(false, "Enable asserts in bn_config_assert.h to run tests");
@@ -47,6 +58,17 @@ int main()
     any_tests();
     format_tests();
     memory_tests memory_tests(used_stack_iwram);
+    decompress_tests decompress_tests;
+    best_fit_allocator_tests();
+    sprites_tests();
+    sprites_grid_tests();
+    particle_system_tests();
+    sprite_affine_mats_tests();
+    affine_mat_table_tests();
+    affine_bg_perspective_plane_tests();
+    hdma_stream_tests();
+    hblank_effects_tests();
+    hbe_values_generators_tests();
     sram_tests sram_tests;
 
     if(sram_tests.again())